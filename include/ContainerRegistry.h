@@ -2,9 +2,14 @@
 
 #include "IContainerSource.h"
 
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
+using PickerList = std::shared_ptr<const std::vector<PickerEntry>>;
+
 /**
  * ContainerRegistry - Central registry for container data sources
  *
@@ -14,12 +19,13 @@
  * 1. Iterate sources in priority order for Resolve()
  * 2. Stop at first source that claims ownership
  * 3. Return fallback ContainerDisplay for unclaimed FormIDs
- * 4. Deduplicate BuildPickerList() results by FormID
- * 5. Sort picker results by group, then alphabetically
+ * 4. Call the owning source's Resolve()/CountItems() on every call
+ * 5. Deduplicate BuildPickerList() results by FormID
+ * 6. Sort picker results by group, then alphabetically
  *
  * MUST NOT:
  * 1. Contain any source-specific code or type checks
- * 2. Cache Resolve() results
+ * 2. Cache Resolve() results (only *which* source owns a FormID is indexed)
  * 3. Know the names/types of registered sources
  * 4. Modify sources after registration
  *
@@ -35,6 +41,23 @@
  * 2. Check FormIDs against known source patterns
  * 3. Apply source-specific rendering logic
  * 4. Cache ContainerDisplay values across frames
+ *
+ * == Ownership Index ==
+ *
+ * The claim scan is memoized per FormID (unclaimed included), so Resolve()
+ * and CountItems() are one hash probe plus the owner's own call. The index
+ * is dropped when the player changes cell and whenever InvalidateOwnership()
+ * bumps the epoch: tag/untag, sell container, container lists, SCIE
+ * responses, picker settings, menu open and game load. A cached owner is
+ * re-checked with OwnsContainer() before use, so a claim that lapses without
+ * an event (follower dismissed) falls back to a fresh scan. Sources that
+ * don't opt into CacheOwnership() and rank above the cached answer are asked
+ * again too, so a claim that appears without an event (follower recruited)
+ * takes over.
+ *
+ * Picker lists share the same epoch: a source that opts into
+ * CachePickerEntries() is re-queried only after an invalidation or a cell
+ * change.
  */
 class ContainerRegistry {
 public:
@@ -49,14 +72,21 @@ public:
     // Returns fallback display for unclaimed FormIDs.
     ContainerDisplay Resolve(RE::FormID a_formID) const;
 
-    // Build aggregated picker list from all sources.
+    // Aggregated picker list from all sources, shared and immutable.
     // Deduplicates by FormID, sorts by group then alphabetically.
-    std::vector<PickerEntry> BuildPickerList(RE::FormID a_masterFormID) const;
+    // Cached per master: only sources that are uncacheable or invalidated
+    // are re-queried, and the merge reruns only if their entries changed.
+    PickerList BuildPickerList(RE::FormID a_masterFormID) const;
 
     // Count playable items in a container, routed through the owning source.
     // UI code must use this instead of LookupByID + GetInventory directly.
     int CountItems(RE::FormID a_formID) const;
 
+    // Drop the ownership index. Call whenever a source may start or stop
+    // claiming a FormID. Cheap and thread-safe; the rebuild is lazy.
+    void InvalidateOwnership();
+    uint32_t GetOwnershipEpoch() const { return m_epoch.load(std::memory_order_acquire); }
+
     // Expose sources for testing (integration tests only)
     const std::vector<std::unique_ptr<IContainerSource>>& GetSources() const { return m_sources; }
 
@@ -66,5 +96,34 @@ private:
     std::vector<std::unique_ptr<IContainerSource>> m_sources;
     bool m_sorted = false;
 
+    // FormID -> index into m_sources, kUnclaimed if no source claims it
+    static constexpr int kUnclaimed = -1;
+
+    mutable std::mutex m_ownerLock;
+    mutable std::unordered_map<RE::FormID, int> m_owners;
+    mutable uint32_t m_ownersEpoch = 0;
+    mutable const RE::TESObjectCELL* m_ownersCell = nullptr;
+    std::atomic<uint32_t> m_epoch{1};
+
+    // Per-master picker model: each source's last entries (non-persistent
+    // refs already dropped) and the merged list built from them
+    struct SourceEntries {
+        std::vector<PickerEntry> entries;
+        uint32_t epoch = 0;  // 0 = never queried
+    };
+    struct PickerModel {
+        std::vector<SourceEntries> sources;
+        PickerList list;
+        const RE::TESObjectCELL* cell = nullptr;  // player cell when built
+    };
+
+    mutable std::mutex m_pickerLock;
+    mutable std::unordered_map<RE::FormID, PickerModel> m_pickerModels;
+
     void EnsureSorted();
+
+    PickerList MergePickerModel(const PickerModel& a_model) const;
+
+    // Index of the owning source, kUnclaimed if none
+    int FindOwner(RE::FormID a_formID) const;
 };
@@ -18,8 +18,20 @@ namespace ContainerScanner {
     // Scans current cell for non-respawning / player-owned containers.
     // Excludes disabled, deleted, non-container refs, and the specified FormID.
     // Used internally by CellScanContainerSource.
+    //
+    // The walk over the cell is cached per cell and reused until a container
+    // ref attaches to or detaches from it (TESCellAttachDetachEvent,
+    // TESMoveAttachDetachEvent), the player changes cell, or ClearCache().
+    // Disabled refs stay in the cached scan and are filtered on every call, so
+    // a container enabled later (no event) shows up without a rescan.
     std::vector<ScannedContainer> ScanCellContainers(RE::FormID a_excludeFormID);
 
+    // Drop the cached scan. Call on save load.
+    void ClearCache();
+
+    // Register the attach/detach sinks that invalidate the scan. Call from kDataLoaded.
+    void RegisterEventSinks();
+
     // Resolves a container FormID to {displayName, locationName}.
     // DEPRECATED: Delegates to ContainerRegistry::Resolve().
     // UI code should call ContainerRegistry directly.
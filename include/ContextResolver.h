@@ -33,7 +33,8 @@ namespace ContextResolver {
         kRestock,
         kRestockConfigure,
         kWhooshAndRestock,
-        kReloadFilters
+        kReloadFilters,
+        kSortAll
     };
 
     struct ActionEntry {
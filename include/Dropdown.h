@@ -22,6 +22,7 @@ public:
         int    maxVisible = 8;
         std::string title;         // optional header (empty = none)
         int    preSelect  = -1;    // pre-highlight index on open (-1 = first enabled)
+        bool   searchable = false; // typing filters rows by label/sublabel (keyboard only)
     };
 
     using Callback = std::function<void(bool confirmed, int index, const std::string& id)>;
@@ -58,6 +59,12 @@ public:
     void Confirm();
     void Cancel();
 
+    // Type-ahead (only when open and Config::searchable).
+    // a_char is a UTF-16 code unit from a CharEvent.
+    void AppendSearchChar(uint32_t a_char);
+    void EraseSearchChar();
+    bool IsSearchable() const;
+
     // Mouse (only when open)
     void OnMouseClick(float a_mx, float a_my);
     void OnScrollWheel(int a_direction);
@@ -86,6 +93,17 @@ private:
     std::vector<Entry> m_entries;
     Config m_config;
 
+    // Rows shown, as indices into m_entries. Cursor, scroll and hover are
+    // positions in this view; without a search query it is every entry.
+    std::vector<int> m_view;
+
+    // Type-ahead search state (Config::searchable only)
+    std::vector<std::wstring> m_searchKeys;  // per entry: lowercased label + sublabel
+    std::vector<int> m_headerOf;             // per entry: index of its section header, -1 = none
+    std::vector<int> m_matches;              // entries matching m_query, headers excluded
+    std::wstring m_query;
+    bool m_ownsTextInput = false;
+
     // Open state
     bool m_open = false;
     Callback m_callback;
@@ -118,6 +136,15 @@ private:
     void DestroyPopupVisuals();
     int FindNextEnabled(int a_from, int a_dir) const;
 
+    int ViewCount() const { return static_cast<int>(m_view.size()); }
+    const Entry& ViewEntry(int a_pos) const { return m_entries[m_view[a_pos]]; }
+
+    void BuildSearchIndex();
+    void ApplySearch(bool a_narrowing);
+    void UpdateTitle();
+    void AcquireTextInput();
+    void ReleaseTextInput();
+
     // Global singleton tracking
     static Dropdown* s_openInstance;
 };
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "IFilter.h"
+#include "Network.h"
 
 #include <filesystem>
 #include <memory>
@@ -19,12 +20,38 @@ public:
     /// Returns true if the given filter ID is the catch-all sentinel.
     static bool IsCatchAll(const std::string& a_id) { return a_id == kCatchAllFilterID; }
 
-    /// Create all filter instances and build family index. Call once from kDataLoaded.
+    /// Create all filter instances, compile their trait programs and build family index.
+    /// Call once from kDataLoaded, after TraitEvaluator::Init().
     void Init();
 
     /// Look up the filter for a given string ID. Returns nullptr if not found.
     const IFilter* GetFilter(const std::string& a_id) const;
 
+    /// Dense filter index: position in GetFilters(). Stable until the next Reload().
+    using FilterIndex = FilterStage::FilterIndex;
+    static constexpr FilterIndex kInvalidIndex = FilterStage::kInvalidIndex;
+
+    /// Index for a string ID, or kInvalidIndex if not found.
+    FilterIndex GetFilterIndex(const std::string& a_id) const;
+
+    /// Filter at a dense index. Returns nullptr if out of range.
+    const IFilter* GetFilterAt(FilterIndex a_index) const {
+        return a_index < m_byIndex.size() ? m_byIndex[a_index] : nullptr;
+    }
+
+    /// All filters as a contiguous array: registration order, catch-all last.
+    const std::vector<const IFilter*>& GetFilters() const { return m_byIndex; }
+
+    /// Filter for a pipeline stage. Uses the stage's cached index, re-resolving
+    /// the string ID only after a reload. Hot loops should resolve once per run.
+    const IFilter* Resolve(const FilterStage& a_stage) const {
+        if (a_stage.filterGeneration != m_generation) {
+            a_stage.filterIndex = GetFilterIndex(a_stage.filterID);
+            a_stage.filterGeneration = m_generation;
+        }
+        return GetFilterAt(a_stage.filterIndex);
+    }
+
     /// Registration order (all filters, roots and children).
     const std::vector<std::string>& GetFilterOrder() const;
 
@@ -47,6 +74,10 @@ public:
     /// Clear all state and re-parse INI files.
     void Reload();
 
+    /// Incremented on every Init()/Reload(). Caches derived from filter
+    /// definitions compare against this to detect a reload.
+    uint32_t GetGeneration() const { return m_generation; }
+
     /// Returns true if any SLID_*.ini file has been modified since last load.
     bool HasPendingChanges() const;
 
@@ -59,6 +90,10 @@ private:
     std::unordered_map<std::string, std::unique_ptr<IFilter>> m_filters;
     std::vector<std::string> m_order;
 
+    // Dense index — built at end of Init()
+    std::vector<const IFilter*> m_byIndex;
+    std::unordered_map<std::string, FilterIndex> m_indices;
+
     // Family index — built at end of Init()
     std::vector<std::string> m_familyRoots;
     std::unordered_map<std::string, std::vector<std::string>> m_children;
@@ -70,4 +105,5 @@ private:
     // Change detection — recorded at end of Init()
     std::filesystem::file_time_type m_lastLoadTime;
     size_t m_lastFileCount = 0;
+    uint32_t m_generation = 0;
 };
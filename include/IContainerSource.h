@@ -1,5 +1,7 @@
 #pragma once
 
+#include "InventoryCache.h"
+
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -16,6 +18,8 @@
  * 1. Return a stable GetSourceID() - used for debugging/logging only
  * 2. Return consistent GetPriority() - determines claim order (lower = first)
  * 3. OwnsContainer() must be pure and fast - no side effects, no I/O
+ *    (the registry indexes its answers - whatever changes them must call
+ *    ContainerRegistry::InvalidateOwnership())
  * 4. Resolve() must handle any FormID passed to it (return valid ContainerDisplay even for edge cases)
  * 5. GetPickerEntries() must return entries with formID, name, group, enabled, color all populated
  * 6. Own all source-specific logic: colors, names, availability checks, picker entry construction
@@ -53,6 +57,8 @@ struct PickerEntry {
     uint8_t group = 0;       // 0=special, 1=follower, 2=tagged, 3=SCIE, 4=scanned
     bool enabled = true;     // false = visible but not selectable
     std::string subGroup;    // optional sub-section label within group (e.g. container list name)
+
+    bool operator==(const PickerEntry&) const = default;
 };
 
 class IContainerSource {
@@ -80,18 +86,22 @@ public:
     // All returned entries MUST pass OwnsContainer() for their FormIDs
     virtual std::vector<PickerEntry> GetPickerEntries(RE::FormID a_masterFormID) const = 0;
 
+    // May the registry reuse GetPickerEntries() results until the next
+    // ContainerRegistry::InvalidateOwnership()? Return true only if every
+    // change to the entries comes with an invalidation. Sources that follow
+    // state nothing reports (follower recruit, player cell) keep the default
+    // and are re-queried on each picker open.
+    virtual bool CachePickerEntries() const { return false; }
+
+    // May the registry cache this source's OwnsContainer() answers until the
+    // next InvalidateOwnership()? Same contract as CachePickerEntries(). Other
+    // sources are asked again whenever a cached answer ranks below them.
+    virtual bool CacheOwnership() const { return false; }
+
     // Count total playable items in a container this source owns.
-    // Default implementation uses LookupByID + GetInventory (works for normal placed refs).
+    // Default implementation reads the InventoryCache snapshot (works for normal placed refs).
     // Sources with non-standard container refs should override.
     virtual int CountItems(RE::FormID a_formID) const {
-        auto* ref = RE::TESForm::LookupByID<RE::TESObjectREFR>(a_formID);
-        if (!ref) return 0;
-        int count = 0;
-        auto inv = ref->GetInventory();
-        for (auto& [item, data] : inv) {
-            if (!item || data.first <= 0 || IsPhantomItem(item)) continue;
-            count += data.first;
-        }
-        return count;
+        return InventoryCache::CountItems(a_formID);
     }
 };
@@ -1,9 +1,12 @@
 #pragma once
 
+#include <cstdint>
 #include <string_view>
+#include <vector>
 
 namespace RE {
     class TESBoundObject;
+    enum class FormType : std::uint8_t;
 }
 
 class IFilter {
@@ -14,6 +17,14 @@ public:
     virtual std::string_view GetDescription() const = 0;  // guide text
     virtual bool Matches(RE::TESBoundObject* a_item) const = 0;
 
+    // True if Matches(a_item) can change with player state (books read, spells known)
+    // rather than being fixed for the base object. Routing caches must not keep such results.
+    virtual bool DependsOnPlayerState(RE::TESBoundObject* a_item) const = 0;
+
+    // FormType gate — Matches() is false for any other type. Empty = any type.
+    // Lets the pipeline skip filters that cannot match an item without calling them.
+    virtual const std::vector<RE::FormType>& GetFormTypes() const = 0;
+
     // Family hierarchy — nullptr for family roots
     virtual const IFilter* GetParent() const = 0;
 
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <RE/Skyrim.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * InventoryCache - Per-container inventory snapshots
+ *
+ * TESObjectREFR::GetInventory() builds a fresh std::map with extra data on
+ * every call. Most SLID reads only need (item, count), so this caches a flat,
+ * phantom-filtered vector per ref FormID.
+ *
+ * Invalidation:
+ * - TESContainerChangedEvent drops both the old and new container.
+ * - Code that moves items calls Invalidate() for source and target (the event
+ *   covers this too; the explicit call keeps reads in the same frame exact).
+ * - Clear() on save load and cell load (respawning containers reset without
+ *   firing container events).
+ *
+ * Callers that need extra data (worn, favorited, quest item) must keep using
+ * GetInventory().
+ */
+namespace InventoryCache {
+
+    struct Entry {
+        RE::TESBoundObject* item;
+        int32_t count;
+    };
+
+    using Snapshot = std::vector<Entry>;
+
+    /// Snapshot of a container's playable items. Built on first use, shared
+    /// until the container is invalidated. Never null (empty for missing refs).
+    std::shared_ptr<const Snapshot> Get(RE::FormID a_formID);
+
+    /// Total playable item count of a container.
+    int32_t CountItems(RE::FormID a_formID);
+
+    /// Drop one container's snapshot.
+    void Invalidate(RE::FormID a_formID);
+
+    /// Drop every snapshot.
+    void Clear();
+
+    /// Bumped on every container change and Clear(). Lets derived caches
+    /// (prediction sessions) detect that any inventory may have moved.
+    uint32_t GetEpoch();
+
+    /// Register the TESContainerChangedEvent sink. Call from kDataLoaded.
+    void RegisterEventSink();
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <RE/Skyrim.h>
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/**
+ * MoveExecutor - Time-sliced item moves
+ *
+ * Executes a list of container-to-container moves on the game thread in
+ * bounded batches, one batch per frame via SKSE's task interface, so a Sort
+ * of thousands of stacks doesn't freeze the game. Each frame moves stacks
+ * until Settings::fSortFrameBudgetMs is spent (at least one per frame).
+ *
+ * Refs are looked up by FormID every frame — a container that disappears
+ * mid-job is skipped. Each move is clamped to what its source still holds
+ * when it runs, and only the items actually moved are counted. A job is cancelled if the player changes cell or a
+ * save is loaded; moves already done stay done.
+ *
+ * One job at a time. Submit() runs the first batch immediately, so small
+ * plans still complete (and call back) synchronously.
+ */
+namespace MoveExecutor {
+
+    struct Move {
+        RE::TESBoundObject* item;
+        int32_t count;
+        RE::FormID sourceFormID;
+        RE::FormID targetFormID;
+        bool staging = false;  // intermediate hop (full Sort's gather) — not reported in perTarget
+    };
+
+    struct Progress {
+        size_t movesDone = 0;
+        size_t movesTotal = 0;
+        uint32_t itemsMoved = 0;
+    };
+
+    struct Result {
+        uint32_t itemsMoved = 0;
+        std::vector<std::pair<RE::FormID, uint32_t>> perTarget;  // target FormID -> items, first-move order, staging excluded
+        bool cancelled = false;
+    };
+
+    using ProgressCallback = std::function<void(const Progress&)>;
+    using CompletionCallback = std::function<void(const Result&)>;
+
+    /// Queue a job. Returns false (and calls nothing) if a job is already running.
+    /// a_onProgress fires after every frame that leaves work remaining.
+    bool Submit(std::vector<Move> a_moves,
+                CompletionCallback a_onComplete,
+                ProgressCallback a_onProgress = nullptr);
+
+    /// Execute every move now, on the calling thread.
+    Result RunNow(const std::vector<Move>& a_moves);
+
+    /// True while a submitted job has moves left.
+    bool IsBusy();
+
+    /// Stop the running job after the current move. Its completion callback
+    /// fires with cancelled = true.
+    void Cancel();
+}
@@ -11,6 +11,14 @@
 struct FilterStage {
     std::string filterID;              // e.g. "weapons", "armor"
     RE::FormID containerFormID = 0;    // 0 = unlinked
+
+    // Runtime cache of filterID's dense FilterRegistry index, refreshed by
+    // FilterRegistry::Resolve() when the registry generation changes. Not saved.
+    // Declared here for FilterRegistry, which includes this header.
+    using FilterIndex = uint16_t;
+    static constexpr FilterIndex kInvalidIndex = 0xFFFF;
+    mutable FilterIndex filterIndex = kInvalidIndex;
+    mutable uint32_t filterGeneration = 0;
 };
 
 struct Network {
@@ -25,6 +33,9 @@ struct Network {
     // Restock configuration (per-network)
     RestockCategory::RestockConfig restockConfig;
 
+    // Auto-route: items deposited into master are routed as they arrive (per-network, opt-in)
+    bool autoRoute = false;
+
     // Runtime-only state (not persisted to cosave)
     bool masterUnavailable = false;  // Set by ValidateNetworks when master can't be resolved
 };
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Network.h"
+#include "TransactionLog.h"
 #include "VendorRegistry.h"
 
 #include <map>
@@ -23,16 +24,6 @@ struct SellContainerState {
     bool        timerStarted    = false;  // persisted
 };
 
-struct SaleTransaction {
-    std::string itemName;
-    std::string vendorName;
-    std::string vendorAssortment;
-    int32_t     quantity;
-    int32_t     goldEarned;
-    float       pricePerUnit;  // float for display (base * percent)
-    float       gameTime;
-};
-
 struct PresetFilterStage {
     std::string filterID;         // e.g. "weapons"
     std::string containerRef;     // raw INI: "Skyrim.esm|0x1234"
@@ -102,6 +93,9 @@ public:
     // Restock configuration
     void SetRestockConfig(const std::string& a_networkName, const RestockCategory::RestockConfig& a_config);
 
+    // Auto-route deposits into master
+    void SetAutoRoute(const std::string& a_networkName, bool a_enabled);
+
     // Nuclear reset — clears everything (networks, tags, sell state, transaction log)
     void ClearAll();
 
@@ -124,10 +118,11 @@ public:
     void RecordSale(uint32_t a_itemCount, uint32_t a_goldAmount);
     void SetLastSellTime(float a_gameHours);
 
-    // Transaction log (in-memory only, newest first)
-    static constexpr size_t kMaxTransactionLog = 100;
+    // Transaction log (persisted, newest first, capacity iTransactionLogSize)
+    // Also folds each transaction into the whole-save sales stats.
     void AppendTransactions(const std::vector<SaleTransaction>& a_transactions);
-    const std::vector<SaleTransaction>& GetTransactionLog() const;
+    const TransactionLog& GetTransactionLog() const;
+    const SalesStats& GetSalesStats() const;
 
     // Cosave callbacks
     static void OnGameSaved(SKSE::SerializationInterface* a_intfc);
@@ -182,6 +177,7 @@ private:
     void LoadTransactionLog(SKSE::SerializationInterface* a_intfc, uint32_t a_version);
     void LoadContainerListState(SKSE::SerializationInterface* a_intfc, uint32_t a_version);
     void LoadRestockConfig(SKSE::SerializationInterface* a_intfc, uint32_t a_version);
+    void LoadAutoRoute(SKSE::SerializationInterface* a_intfc, uint32_t a_version);
     void Revert();
 
     // Build default empty filter list
@@ -192,7 +188,8 @@ private:
     std::unordered_map<RE::FormID, TaggedContainer> m_tagRegistry;
     std::set<std::string> m_recognizedMods;
     SellContainerState m_sellState;
-    std::vector<SaleTransaction> m_transactionLog;
+    TransactionLog m_transactionLog;
+    SalesStats m_salesStats;
     std::vector<NetworkPreset> m_presets;
     std::vector<ContainerList> m_containerLists;
     std::set<std::string> m_disabledContainerLists;
@@ -207,9 +204,11 @@ private:
     static constexpr uint32_t kNetworkVersion = 4;
     static constexpr uint32_t kTagsVersion = 1;
     static constexpr uint32_t kModsVersion = 1;
-    static constexpr uint32_t kSellVersion = 1;
-    static constexpr uint32_t kTlogVersion = 1;
+    static constexpr uint32_t kSellVersion = 2;
+    static constexpr uint32_t kTlogVersion = 2;
     static constexpr uint32_t kClstVersion = 1;
     static constexpr uint32_t kRstkRecord = 'RSTK';
     static constexpr uint32_t kRstkVersion = 2;
+    static constexpr uint32_t kAutoRecord = 'AUTO';
+    static constexpr uint32_t kAutoVersion = 1;
 };
@@ -0,0 +1,29 @@
+#pragma once
+
+namespace PipelineBenchmark {
+
+    /**
+     * Filter pipeline micro-benchmark
+     *
+     * Times the hot paths of Sort and Restock against the filters actually
+     * loaded from SLID_Filters.ini, over a synthetic pool built from the
+     * game's own item forms (weapons, armor, potions, ingredients, books,
+     * scrolls, ammo, soul gems, misc). Results go to SLID.log:
+     *
+     * - Match:    every filter's Matches() per item, cold (TraitCache
+     *             cleared — the cost for an unseen base object) and warm
+     *             (traits memoized)
+     * - Pipeline: RunPipeline() over all family roots + catch-all, cold
+     *             (route table cleared) and warm (decisions memoized)
+     * - Classify: RestockCategory::Lookup() per item
+     *
+     * Each pass reports total ms and ns/item. The pool cycles through the
+     * distinct forms, so large counts repeat base objects the way merged
+     * container inventories do.
+     *
+     * Run from the console: cgf "SLID_Native.RunPipelineBenchmark" 100000
+     * Uses a fake master FormID and clears the route tables afterwards.
+     */
+    void Run(uint32_t a_itemCount);
+
+}
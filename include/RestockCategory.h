@@ -37,8 +37,30 @@ namespace RestockCategory {
     /// True if the given ID is a family root with children
     bool IsFamilyRoot(const std::string& a_id);
 
+    /// Dense category index: position in GetAllCategories().
+    using CategoryIndex = uint8_t;
+    inline constexpr CategoryIndex kNoCategory = 0xFF;
+
+    /// Index for a category ID, or kNoCategory if unknown.
+    CategoryIndex GetCategoryIndex(const std::string& a_id);
+
+    struct Classification {
+        CategoryIndex category = kNoCategory;
+        float quality = 0.0f;  // QualityScore() within the category
+    };
+
+    /// Classify every AlchemyItem, Ammo and SoulGem form once. Call from kDataLoaded.
+    void BuildTable();
+
+    /// Forget memoized player-made (FF) potions. Call when a save is loaded.
+    void ClearDynamic();
+
+    /// Category and quality of an item, from the prebuilt table (player-made
+    /// potions are classified on first sight and memoized).
+    Classification Lookup(RE::TESBoundObject* a_item);
+
     /// Classify an item into its first matching category ID (first-claim-wins).
-    /// Returns empty string if no category matches.
+    /// Returns empty string if no category matches. Served from Lookup().
     std::string Classify(RE::TESBoundObject* a_item);
 
     /// Quality score for an item within a category (higher = better).
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "RestockCategory.h"
+
+#include <RE/Skyrim.h>
+
+#include <bitset>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * RestockIndex - Per-container Restock holdings by category
+ *
+ * Restock needs, for each category in deficit, which containers hold items
+ * of that category and how good they are. This keeps one index per
+ * container: a category bitset plus (item, count, quality) lists per
+ * category, built from the container's InventoryCache snapshot through the
+ * RestockCategory table.
+ *
+ * An index is rebuilt only when its container's snapshot changes, which
+ * InventoryCache drives from TESContainerChangedEvent. The index holds the
+ * snapshot it was built from, so a recycled allocation can never be
+ * mistaken for an unchanged container.
+ *
+ * Game thread only.
+ */
+namespace RestockIndex {
+
+    using CategoryMask = std::bitset<256>;
+
+    struct Holding {
+        RE::TESBoundObject* item;
+        int32_t count;
+        float quality;
+    };
+
+    struct ContainerIndex {
+        CategoryMask categories;  // categories with at least one holding
+        std::unordered_map<RestockCategory::CategoryIndex, std::vector<Holding>> holdings;
+        std::unordered_map<RestockCategory::CategoryIndex, int32_t> totals;  // item count per category
+    };
+
+    /// Index for a container, rebuilt if its inventory changed since the last call.
+    const ContainerIndex& Get(RE::FormID a_formID);
+
+    /// Drop every index. Call when a save is loaded.
+    void Clear();
+}
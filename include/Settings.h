@@ -15,6 +15,10 @@ namespace Settings {
     inline bool bShownWelcomeTutorial = false;  // Has user seen the welcome popup?
     inline bool bInterceptActivation = false;  // Intercept master/sell activation with MessageBox
 
+    // --- [Sort] ---
+    inline bool bDeltaSort = true;    // Move only misplaced stacks (false = gather everything, then distribute)
+    inline float fSortFrameBudgetMs = 4.0f;  // Per-frame time budget for Sorts run in the background
+
     // --- [Powers] ---
     inline bool bSummonEnabled = true;
 
@@ -84,6 +88,8 @@ namespace Settings {
     inline float   fSellPricePercent   = 0.10f;
     inline int32_t iSellBatchSize      = 10;
     inline float   fSellIntervalHours  = 24.0f;
+    inline int32_t iMaxCatchUpIntervals = 30;   // owed batches sold at once after long waits (general + vendors)
+    inline int32_t iTransactionLogSize  = 2000; // sales kept in the overview history (100 - 50000)
 
     // --- [VendorSales] ---
     inline float   fVendorPricePercent   = 0.25f;   // 25% base value for registered vendors
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace RE {
+    class TESBoundObject;
+}
+
+/**
+ * TraitCache - Interned trait table + per-item trait memo
+ *
+ * Every unique trait string used by the loaded filters gets one bit. Each
+ * base object seen by a filter gets a (known, value) bitset keyed by FormID;
+ * a trait is evaluated at most once per object and every later filter match
+ * is served from bits.
+ *
+ * Volatility classes:
+ * - Static traits depend only on the base object. Memoized until Build()
+ *   (FilterRegistry Init/Reload) or Clear().
+ * - Volatile traits (unread_book, unlearned_spell, unknown_enchantment)
+ *   depend on player state. Memoized until the next InvalidateVolatile(),
+ *   which every top-level Distributor operation calls on entry.
+ * - Dynamic forms (FF-prefixed player-made potions/enchantments) can reuse
+ *   FormIDs, so all their bits are treated as volatile.
+ */
+namespace TraitCache {
+
+    using Mask = std::vector<uint64_t>;
+
+    /// A filter's trait lists compiled to interned-trait masks.
+    struct Program {
+        Mask require;     // all bits must be set
+        Mask exclude;     // no bits may be set
+        Mask requireAny;  // at least one bit set (empty = no RequireAnyTrait)
+    };
+
+    /// Intern and compile all trait strings, drop every memoized item.
+    /// Called by FilterRegistry::Init() after TraitEvaluator::Init().
+    void Build(const std::vector<std::string>& a_traits);
+
+    /// Translate trait string lists into interned masks.
+    /// Traits that were not passed to Build() are interned on demand.
+    Program Compile(const std::vector<std::string>& a_require,
+                    const std::vector<std::string>& a_exclude,
+                    const std::vector<std::string>& a_requireAny);
+
+    /// True if the program references any volatile trait.
+    bool IsVolatile(const Program& a_program);
+
+    /// Run a compiled program against an item, evaluating only traits not yet memoized.
+    bool Matches(const Program& a_program, RE::TESBoundObject* a_item);
+
+    /// Forget volatile trait results (and all results for dynamic forms).
+    void InvalidateVolatile();
+
+    /// Drop every memoized item (interned table is kept).
+    /// Called when a save is loaded — scripts may have edited FormLists.
+    void Clear();
+
+    /// Current volatility generation. Changes on every InvalidateVolatile(),
+    /// Clear() and Build(); never 0. Lets downstream caches stamp results
+    /// that were derived from volatile traits.
+    uint32_t GetGeneration();
+
+    /// Number of interned traits.
+    size_t GetTraitCount();
+
+    /// Number of memoized base objects (diagnostics).
+    size_t GetEntryCount();
+}
@@ -1,18 +1,83 @@
 #pragma once
 
-#include <string>
+#include <RE/Skyrim.h>
 
-namespace RE {
-    class TESBoundObject;
-}
+#include <cstdint>
+#include <string>
+#include <unordered_set>
 
 namespace TraitEvaluator {
+
+    /// Opcode of a compiled trait. One per (prefix, suffix) pair the evaluator
+    /// understands — the suffix is resolved into CompiledTrait operands.
+    enum class Op : uint8_t {
+        kNever,              // unknown/unresolvable trait — always false
+        kFormType,           // formtype:X          → formType
+        kKeyword,            // keyword:X (ESP)     → keyword
+        kKeywordString,      // keyword:X (dynamic) → text suffix via HasKeywordString
+        kWeaponType,         // weapon_type:X       → weaponType
+        kSlot,               // slot:X              → slotMask
+        kShield,             // slot:shield
+        kArmorLight,         // armor_weight:light
+        kArmorHeavy,         // armor_weight:heavy
+        kArmorClothing,      // armor_weight:clothing
+        kCookedFood,         // cobj_output:CraftingCookpot
+        kTanningOutput,      // cobj_output:CraftingTanningRack
+        kSmeltableInput,     // cobj_input:CraftingSmelter
+        kHearthfireMat,      // cobj_input:BYOHCarpenterTable
+        kFormIDSet,          // in_pool:X / in_group:X → formIDs (nullptr = group not loaded)
+        kFormList,           // formlist:X          → formList (nullptr = not resolved)
+        kIsFood,
+        kIsPoison,
+        kHasEnchantment,
+        kHasSpell,
+        kTeachesSkill,
+        kIsNote,
+        kUnreadBook,
+        kUnlearnedSpell,
+        kUnknownEnchantment,
+    };
+
+    /// A trait string pre-parsed into an opcode plus its resolved operand.
+    /// Built once when filter definitions load; evaluating it does no string
+    /// hashing or allocation.
+    struct CompiledTrait {
+        Op op = Op::kNever;
+        union {
+            RE::FormType formType;
+            RE::WEAPON_TYPE weaponType;
+            RE::BGSBipedObjectForm::BipedObjectSlot slotMask;
+            RE::BGSKeyword* keyword;
+            RE::BGSListForm* formList;
+            const std::unordered_set<RE::FormID>* formIDs;
+        };
+        std::string text;     // original trait string (diagnostics, trait collection)
+        size_t suffixPos = 0; // offset of the suffix in text (kKeywordString)
+
+        CompiledTrait() : formIDs(nullptr) {}
+    };
+
     /// Resolve keyword pointers and build dispatch table.
     /// Call once at kDataLoaded, after Settings::LoadUniqueItems().
     void Init();
 
+    /// Parse a trait string into its compiled form.
+    /// Unknown trait names compile to Op::kNever (logs warning once).
+    /// Call after Init() — keyword and formlist operands are resolved here.
+    CompiledTrait Compile(const std::string& traitName);
+
+    /// True for traits whose result depends on player state (books read,
+    /// spells/enchantments known) rather than on the base object alone.
+    inline bool IsVolatile(Op op) {
+        return op == Op::kUnreadBook || op == Op::kUnlearnedSpell || op == Op::kUnknownEnchantment;
+    }
+
+    /// Evaluate a compiled trait against an item.
+    bool Evaluate(const CompiledTrait& trait, RE::TESBoundObject* item);
+
     /// Evaluate a single atomic trait against an item.
     /// Returns false for unknown trait names (logs warning once).
+    /// Compiles on every call — prefer Compile() + Evaluate() on hot paths.
     bool Evaluate(const std::string& traitName, RE::TESBoundObject* item);
 
     /// Clear runtime caches (keyword, formlist, warned-unknown).
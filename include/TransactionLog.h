@@ -0,0 +1,122 @@
+#pragma once
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// A sale as produced by Distributor::ProcessSales / ProcessVendorSales
+struct SaleTransaction {
+    RE::FormID   itemFormID = 0;
+    RE::FormType itemType   = RE::FormType::None;
+    std::string  itemName;
+    std::string  vendorName;
+    std::string  vendorAssortment;
+    int32_t      quantity;
+    int32_t      goldEarned;
+    float        pricePerUnit;  // float for display (base * percent)
+    float        gameTime;
+};
+
+// A logged sale. Vendor and assortment are IDs into the log's string table;
+// the item name is looked up from its FormID when displayed. Player-made (FF)
+// items are usually destroyed by the sale, so their name is interned instead.
+struct SaleRecord {
+    RE::FormID itemFormID   = 0;
+    uint16_t   vendorID     = 0;
+    uint16_t   assortmentID = 0;
+    uint16_t   itemNameID   = 0xFFFF;  // kNoName unless the item can't be looked up later
+    int32_t    quantity     = 0;
+    int32_t    goldEarned   = 0;
+    float      pricePerUnit = 0.0f;
+    float      gameTime     = 0.0f;
+};
+
+struct SalesTotals {
+    uint32_t items = 0;
+    uint32_t gold  = 0;
+
+    float AveragePrice() const { return items ? static_cast<float>(gold) / static_cast<float>(items) : 0.0f; }
+};
+
+/**
+ * Whole-save sales aggregates
+ *
+ * Updated per transaction as sales are logged, so the sell overview reads
+ * them in constant time however long the save has been selling. Unlike the
+ * transaction log, nothing ever falls off. Persisted in the SELL record.
+ */
+struct SalesStats {
+    SalesTotals total;
+    std::unordered_map<std::string, SalesTotals> byVendor;
+    std::map<RE::FormType, SalesTotals> byFormType;
+    std::map<uint32_t, SalesTotals> byDay;  // game day = hours passed / 24
+
+    // Running leaders, kept current by Add()
+    std::string topVendor;
+    uint32_t    bestDay = 0;
+
+    static uint32_t DayOf(float a_gameHours) { return static_cast<uint32_t>(std::max(0.0f, a_gameHours) / 24.0f); }
+
+    void Add(const std::string& a_vendor, RE::FormType a_type, int32_t a_quantity, int32_t a_gold, float a_gameTime);
+    void Add(const SaleTransaction& a_transaction);
+    void Clear();
+    bool Empty() const { return total.items == 0; }
+
+    // Gold over the a_days game days ending with a_today, one lookup per day
+    uint32_t GoldOverDays(uint32_t a_today, uint32_t a_days) const;
+
+    void Save(SKSE::SerializationInterface* a_intfc) const;
+    void Load(SKSE::SerializationInterface* a_intfc);
+};
+
+/**
+ * Fixed-capacity sales history, newest first
+ *
+ * Records live in a ring buffer: appending never shifts, and once full each
+ * new sale overwrites the oldest. Strings are interned once (vendors repeat
+ * across thousands of sales), so memory and the TLOG record stay at roughly
+ * 28 bytes per sale regardless of names.
+ *
+ * Not synchronized; NetworkManager guards it with its own lock.
+ */
+class TransactionLog {
+public:
+    static constexpr uint16_t kNoName = 0xFFFF;
+    static constexpr size_t kMinCapacity = 100;
+    static constexpr size_t kMaxCapacity = 50000;
+
+    // Resize, keeping the newest records that fit
+    void SetCapacity(size_t a_capacity);
+    size_t Capacity() const { return m_records.size(); }
+
+    void Append(const SaleTransaction& a_transaction);
+    void Clear();
+
+    size_t Size() const { return m_count; }
+    bool Empty() const { return m_count == 0; }
+
+    // 0 = newest, Size() - 1 = oldest
+    const SaleRecord& operator[](size_t a_index) const;
+
+    const std::string& GetString(uint16_t a_id) const;
+    std::string GetItemName(const SaleRecord& a_record) const;
+
+    // TLOG record body. Load accepts version 1 (one string triple per sale).
+    void Save(SKSE::SerializationInterface* a_intfc) const;
+    void Load(SKSE::SerializationInterface* a_intfc, uint32_t a_version);
+
+private:
+    uint16_t Intern(const std::string& a_string);
+    void Push(const SaleRecord& a_record);
+
+    // Drop strings no live record references, renumbering the rest
+    void CompactStrings();
+
+    std::vector<SaleRecord> m_records;  // ring storage, Capacity() slots
+    size_t m_head  = 0;                 // slot the next record goes to
+    size_t m_count = 0;
+
+    std::vector<std::string> m_strings;
+    std::unordered_map<std::string, uint16_t> m_stringIDs;
+};
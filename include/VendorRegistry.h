@@ -1,7 +1,9 @@
 #pragma once
 
+#include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -18,6 +20,24 @@ struct RegisteredVendor {
     bool        invested         = false;  // player has invested in this vendor (500+ gold on person)
 };
 
+// A vendor faction's buy list compiled to a bitset over the registry's keyword space
+struct CompiledBuyList {
+    std::vector<uint64_t> mask;  // keywords in the faction's vendorSellBuyList
+    bool inverted = false;       // vendorValues.notBuySell — buys everything NOT in the list
+};
+
+// Every registered vendor's faction buy list, compiled over one shared keyword
+// space (one bit per distinct keyword across all lists). Immutable once built.
+struct CompiledBuyLists {
+    std::unordered_map<RE::FormID, uint16_t> keywordBits;      // keyword FormID -> bit
+    std::unordered_map<RE::FormID, CompiledBuyList> lists;     // faction FormID -> list
+
+    const CompiledBuyList* Find(RE::FormID a_factionFormID) const;
+
+    /// Item's keywords over the same bit space (only buy-list keywords are set).
+    void GetItemKeywordMask(RE::TESBoundObject* a_item, std::vector<uint64_t>& a_out) const;
+};
+
 class VendorRegistry {
 public:
     static VendorRegistry* GetSingleton();
@@ -47,6 +67,14 @@ public:
     // Validation — prune vendors whose NPC base form no longer exists
     int Validate();
 
+    // Buy lists — recompiled under the lock on first use after vendors change.
+    // Callers hold the returned snapshot for the whole sale pass, so a vendor
+    // registered mid-pass can't pull the lists out from under them.
+    std::shared_ptr<const CompiledBuyLists> GetBuyLists();
+
+    /// True if the vendor with a_buyList buys an item with a_itemMask.
+    static bool Buys(const CompiledBuyList& a_buyList, const std::vector<uint64_t>& a_itemMask);
+
     // Whitelist — loaded from [Vendors] sections in SLID_*.ini files
     void LoadWhitelist();
     bool IsAllowedVendor(RE::FormID a_npcBaseFormID) const;
@@ -65,4 +93,10 @@ private:
     mutable std::mutex m_lock;
     std::vector<RegisteredVendor> m_vendors;
     std::unordered_set<RE::FormID> m_allowedVendors;
+
+    // Compiled buy lists — m_buyListsDirty is set whenever m_vendors changes.
+    // Both are guarded by m_lock.
+    std::shared_ptr<const CompiledBuyLists> CompileBuyLists() const;
+    bool m_buyListsDirty = true;
+    std::shared_ptr<const CompiledBuyLists> m_buyLists;
 };
@@ -181,6 +181,8 @@ namespace ActivationHook {
 
         // Execute Whoosh for a network — pops WhooshConfigMenu if not yet configured
         void ExecuteWhoosh(const std::string& a_networkName) {
+            if (Feedback::NotifyIfMoveBusy()) return;
+
             auto* mgr = NetworkManager::GetSingleton();
             auto* net = mgr->FindNetwork(a_networkName);
             if (!net) return;
@@ -192,6 +194,7 @@ namespace ActivationHook {
                         if (!confirmed) return;
                         auto* nmgr = NetworkManager::GetSingleton();
                         nmgr->SetWhooshConfig(networkName, filters);
+                        if (Feedback::NotifyIfMoveBusy()) return;
 
                         auto moved = Distributor::Whoosh(networkName);
                         if (moved > 0) {
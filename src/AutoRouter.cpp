@@ -0,0 +1,103 @@
+#include "AutoRouter.h"
+#include "Distributor.h"
+#include "MoveExecutor.h"
+#include "NetworkManager.h"
+#include "Settings.h"
+
+#include <mutex>
+
+namespace AutoRouter {
+
+    // Deposits are coalesced per master and routed once on the next frame, so
+    // a Whoosh dumping hundreds of stacks costs one batched pass.
+    static std::mutex s_lock;
+    static std::unordered_map<RE::FormID, std::unordered_map<RE::FormID, int32_t>> s_pending;  // master -> base -> count
+    static bool s_flushQueued = false;
+
+    static void Flush() {
+        // A running job was planned before these deposits arrived — keep them
+        // pending and try again next frame, once the executor is idle
+        if (MoveExecutor::IsBusy()) {
+            SKSE::GetTaskInterface()->AddTask([]() { Flush(); });
+            return;
+        }
+
+        std::unordered_map<RE::FormID, std::unordered_map<RE::FormID, int32_t>> pending;
+        {
+            std::lock_guard lock(s_lock);
+            pending.swap(s_pending);
+            s_flushQueued = false;
+        }
+
+        auto* mgr = NetworkManager::GetSingleton();
+        for (const auto& [masterFormID, items] : pending) {
+            auto networkName = mgr->FindNetworkByMaster(masterFormID);
+            if (networkName.empty()) continue;
+
+            std::vector<Distributor::PoolItem> deposits;
+            deposits.reserve(items.size());
+            for (const auto& [baseFormID, count] : items) {
+                auto* item = RE::TESForm::LookupByID<RE::TESBoundObject>(baseFormID);
+                if (!item || count <= 0 || IsPhantomItem(item)) continue;
+                deposits.push_back({item, count});
+            }
+            if (deposits.empty()) continue;
+
+            Distributor::RouteDeposits(networkName, deposits);
+        }
+    }
+
+    namespace {
+        class ContainerChangedListener : public RE::BSTEventSink<RE::TESContainerChangedEvent> {
+        public:
+            static ContainerChangedListener* GetSingleton() {
+                static ContainerChangedListener singleton;
+                return &singleton;
+            }
+
+            RE::BSEventNotifyControl ProcessEvent(
+                const RE::TESContainerChangedEvent* a_event,
+                RE::BSTEventSource<RE::TESContainerChangedEvent>*) override {
+                if (!a_event || !Settings::bModEnabled) return RE::BSEventNotifyControl::kContinue;
+                if (a_event->newContainer == 0 || a_event->itemCount <= 0) return RE::BSEventNotifyControl::kContinue;
+
+                auto* mgr = NetworkManager::GetSingleton();
+                auto networkName = mgr->FindNetworkByMaster(a_event->newContainer);
+                if (networkName.empty()) return RE::BSEventNotifyControl::kContinue;
+
+                auto* net = mgr->FindNetwork(networkName);
+                if (!net || !net->autoRoute) return RE::BSEventNotifyControl::kContinue;
+
+                // Items coming back from the network's own containers (Sweep, Sort) stay put
+                for (const auto& stage : net->filters) {
+                    if (stage.containerFormID != 0 && stage.containerFormID == a_event->oldContainer) {
+                        return RE::BSEventNotifyControl::kContinue;
+                    }
+                }
+
+                std::lock_guard lock(s_lock);
+                s_pending[a_event->newContainer][a_event->baseObj] += a_event->itemCount;
+                if (!s_flushQueued) {
+                    s_flushQueued = true;
+                    SKSE::GetTaskInterface()->AddTask([]() { Flush(); });
+                }
+                return RE::BSEventNotifyControl::kContinue;
+            }
+
+        private:
+            ContainerChangedListener() = default;
+        };
+    }
+
+    void RegisterEventSink() {
+        auto* holder = RE::ScriptEventSourceHolder::GetSingleton();
+        if (!holder) return;
+        holder->AddEventSink<RE::TESContainerChangedEvent>(ContainerChangedListener::GetSingleton());
+        logger::info("AutoRouter: registered container-change listener");
+    }
+
+    void Clear() {
+        std::lock_guard lock(s_lock);
+        s_pending.clear();
+    }
+}
@@ -0,0 +1,10 @@
+#pragma once
+
+namespace AutoRouter {
+    // Register the container-change sink that collects deposits into
+    // auto-route masters. Call from kDataLoaded.
+    void RegisterEventSink();
+
+    // Drop deposits not yet routed. Call on game load / new game.
+    void Clear();
+}
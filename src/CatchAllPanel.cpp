@@ -205,12 +205,12 @@ namespace CatchAllPanel {
 
         // Build dropdown entries — no Pass for catch-all (items must route somewhere)
         auto pickerEntries = ContainerRegistry::GetSingleton()->BuildPickerList(s_masterFormID);
-        if (pickerEntries.empty()) return;
+        if (pickerEntries->empty()) return;
 
         std::vector<Dropdown::Entry> entries;
         int preSelect = -1;
 
-        for (const auto& pe : pickerEntries) {
+        for (const auto& pe : *pickerEntries) {
             // Skip Pass — catch-all must always route to a container
             if (pe.formID == 0 && pe.group == 0 && pe.name == T("$SLID_Pass")) continue;
 
@@ -246,6 +246,7 @@ namespace CatchAllPanel {
         cfg.width = 400.0;
         cfg.title = T("$SLID_SelectContainer");
         cfg.preSelect = preSelect;
+        cfg.searchable = true;
 
         s_dropdown.Open(s_movie, ROW_X + COL_CONTAINER_X, CATCHALL_ROW_Y,
                         cfg, std::move(entries), HandleDropdownResult);
@@ -17,6 +17,9 @@ namespace {
  *
  * Note: This source has lowest priority since scanned containers should only
  * be selected when no other source claims them.
+ *
+ * Picker entries come from ContainerScanner's cached cell scan, so reopening
+ * the picker in the same cell doesn't walk the cell's references again.
  */
 class CellScanContainerSource : public IContainerSource {
 public:
@@ -16,6 +16,7 @@
 #include "WelcomeMenu.h"
 #include "FontTestMenu.h"
 #include "SCIEIntegration.h"
+#include "ContainerRegistry.h"
 #include "ContainerScanner.h"
 #include "ContainerUtils.h"
 #include "ContextResolver.h"
@@ -24,6 +25,7 @@
 #include "WhooshConfigMenu.h"
 #include "RestockConfigMenu.h"
 #include "DisplayName.h"
+#include "PipelineBenchmark.h"
 
 #include <random>
 
@@ -894,6 +896,7 @@ namespace ConsoleCommands {
 
         void SetIncludeUnlinkedContainers(RE::StaticFunctionTag*, bool a_enabled) {
             Settings::SetIncludeUnlinkedContainers(a_enabled);
+            ContainerRegistry::GetSingleton()->InvalidateOwnership();
             logger::info("SetIncludeUnlinkedContainers: {}", a_enabled);
         }
 
@@ -903,6 +906,7 @@ namespace ConsoleCommands {
 
         void SetIncludeSCIEContainers(RE::StaticFunctionTag*, bool a_enabled) {
             Settings::SetSCIEIncludeContainers(a_enabled);
+            ContainerRegistry::GetSingleton()->InvalidateOwnership();
             logger::info("SetIncludeSCIEContainers: {}", a_enabled);
         }
 
@@ -1022,21 +1026,39 @@ namespace ConsoleCommands {
         int32_t RunSort(RE::StaticFunctionTag*, RE::BSFixedString a_networkName) {
             std::string name = a_networkName.c_str();
             if (name.empty()) return 0;
+            if (Feedback::NotifyIfMoveBusy()) return 0;
 
             auto result = Distributor::Distribute(name);
             logger::info("RunSort({}): {} items distributed", name, result.totalItems);
             return static_cast<int32_t>(result.totalItems);
         }
 
+        int32_t RunSortAll(RE::StaticFunctionTag*) {
+            if (Feedback::NotifyIfMoveBusy()) return 0;
+            auto result = Distributor::DistributeAll();
+            logger::info("RunSortAll: {} items distributed", result.totalItems);
+            return static_cast<int32_t>(result.totalItems);
+        }
+
         int32_t RunSweep(RE::StaticFunctionTag*, RE::BSFixedString a_networkName) {
             std::string name = a_networkName.c_str();
             if (name.empty()) return 0;
+            if (Feedback::NotifyIfMoveBusy()) return 0;
 
             auto gathered = Distributor::GatherToMaster(name);
             logger::info("RunSweep({}): {} items gathered", name, gathered);
             return static_cast<int32_t>(gathered);
         }
 
+        bool GetAutoRoute(RE::StaticFunctionTag*, RE::BSFixedString a_networkName) {
+            auto* network = NetworkManager::GetSingleton()->FindNetwork(a_networkName.c_str());
+            return network && network->autoRoute;
+        }
+
+        void SetAutoRoute(RE::StaticFunctionTag*, RE::BSFixedString a_networkName, bool a_enabled) {
+            NetworkManager::GetSingleton()->SetAutoRoute(a_networkName.c_str(), a_enabled);
+        }
+
         int32_t GetNetworkContainerCount(RE::StaticFunctionTag*, RE::BSFixedString a_networkName) {
             auto* mgr = NetworkManager::GetSingleton();
             auto* network = mgr->FindNetwork(a_networkName.c_str());
@@ -1148,6 +1170,7 @@ namespace ConsoleCommands {
 
         void SetSCIEIncludeContainers(RE::StaticFunctionTag*, bool a_enabled) {
             Settings::SetSCIEIncludeContainers(a_enabled);
+            ContainerRegistry::GetSingleton()->InvalidateOwnership();
         }
 
         // =================================================================
@@ -1856,6 +1879,7 @@ namespace ConsoleCommands {
 
     /// Execute Whoosh for a network — pops WhooshConfigMenu if not yet configured.
     void DoWhoosh(const std::string& a_networkName) {
+        if (Feedback::NotifyIfMoveBusy()) return;
         auto* mgr = NetworkManager::GetSingleton();
         auto* net = mgr->FindNetwork(a_networkName);
         if (!net) return;
@@ -1867,6 +1891,7 @@ namespace ConsoleCommands {
                     if (!confirmed) return;
                     auto* nmgr = NetworkManager::GetSingleton();
                     nmgr->SetWhooshConfig(networkName, filters);
+                    if (Feedback::NotifyIfMoveBusy()) return;
 
                     auto moved = Distributor::Whoosh(networkName);
                     if (moved > 0) {
@@ -1892,14 +1917,32 @@ namespace ConsoleCommands {
 
     /// Run Sort (distribute) for a network.
     void DoSort(const std::string& a_networkName) {
-        auto result = Distributor::Distribute(a_networkName);
-        Feedback::OnSort();
-        std::string msg = TF("$SLID_NotifySorted", std::to_string(result.totalItems));
-        RE::DebugNotification(msg.c_str());
+        if (Feedback::NotifyIfMoveBusy()) return;
+
+        Distributor::DistributeAsync(a_networkName, [](const Distributor::DistributeResult& a_result) {
+            Feedback::OnSort();
+            auto key = a_result.cancelled ? "$SLID_NotifySortInterrupted" : "$SLID_NotifySorted";
+            std::string msg = TF(key, std::to_string(a_result.totalItems));
+            RE::DebugNotification(msg.c_str());
+        }, Distributor::MakeSortProgressNotifier());
+    }
+
+    /// Run Sort for every Link as one batched job.
+    void DoSortAll() {
+        if (Feedback::NotifyIfMoveBusy()) return;
+
+        Distributor::DistributeAllAsync([](const Distributor::DistributeResult& a_result) {
+            Feedback::OnSort();
+            auto key = a_result.cancelled ? "$SLID_NotifySortInterrupted" : "$SLID_NotifySortedAll";
+            std::string msg = TF(key, std::to_string(a_result.totalItems));
+            RE::DebugNotification(msg.c_str());
+        }, Distributor::MakeSortProgressNotifier());
     }
 
     /// Sweep (gather all items back to master).
     void DoSweep(const std::string& a_networkName) {
+        if (Feedback::NotifyIfMoveBusy()) return;
+
         auto gathered = Distributor::GatherToMaster(a_networkName);
         std::string msg = TF("$SLID_NotifySwept", std::to_string(gathered));
         RE::DebugNotification(msg.c_str());
@@ -2125,6 +2168,8 @@ namespace ConsoleCommands {
 
     /// Execute restock for a network. If not configured, show config menu first.
     void DoRestock(const std::string& a_networkName) {
+        if (Feedback::NotifyIfMoveBusy()) return;
+
         auto* mgr = NetworkManager::GetSingleton();
         auto* net = mgr->FindNetwork(a_networkName);
         if (!net) return;
@@ -2136,6 +2181,7 @@ namespace ConsoleCommands {
                     if (!confirmed) return;
                     auto* nmgr = NetworkManager::GetSingleton();
                     nmgr->SetRestockConfig(networkName, config);
+                    if (Feedback::NotifyIfMoveBusy()) return;
 
                     auto result = Distributor::Restock(networkName);
                     if (result.totalItems > 0) {
@@ -2144,7 +2190,7 @@ namespace ConsoleCommands {
                     } else {
                         RE::DebugNotification(T("$SLID_NothingToRestock").c_str());
                     }
-                });
+                }, a_networkName);
             return;
         }
 
@@ -2172,11 +2218,13 @@ namespace ConsoleCommands {
                 if (!confirmed) return;
                 NetworkManager::GetSingleton()->SetRestockConfig(networkName, config);
                 logger::info("Restock: reconfigured via context menu hold");
-            });
+            }, a_networkName);
     }
 
     /// Execute Whoosh then Restock in sequence.
     void DoWhooshAndRestock(const std::string& a_networkName) {
+        if (Feedback::NotifyIfMoveBusy()) return;
+
         // Whoosh first (dumps inventory to master)
         DoWhoosh(a_networkName);
 
@@ -2194,9 +2242,10 @@ namespace ConsoleCommands {
     }
 
     void DoReloadFilters() {
+        // Evaluator tables must be rebuilt before Reload() compiles filter traits
         TraitEvaluator::ClearCaches();
-        FilterRegistry::GetSingleton()->Reload();
         TraitEvaluator::Init();
+        FilterRegistry::GetSingleton()->Reload();
         TraitEvaluator::ValidateKeywords();
         RE::DebugNotification(T("$SLID_FiltersReloaded").c_str());
         logger::info("Filters reloaded by user request");
@@ -2219,6 +2268,9 @@ namespace ConsoleCommands {
             case Action::kSort:
                 DoSort(a_networkName);
                 break;
+            case Action::kSortAll:
+                DoSortAll();
+                break;
             case Action::kSweep:
                 DoSweep(a_networkName);
                 break;
@@ -2267,6 +2319,14 @@ namespace ConsoleCommands {
         }
     }
 
+    /// Debug: time filter matching, RunPipeline and Restock classification (results in SLID.log).
+    void RunPipelineBenchmark(RE::StaticFunctionTag*, int32_t a_itemCount) {
+        auto count = static_cast<uint32_t>(std::clamp(a_itemCount, 0, 1000000));
+        SKSE::GetTaskInterface()->AddTask([count]() {
+            PipelineBenchmark::Run(count);
+        });
+    }
+
     /// Unified power native: resolve context from crosshair, show menu or fire directly.
     void BeginContextAction(RE::StaticFunctionTag*) {
         auto targetFormID = g_capturedTarget.exchange(0);
@@ -2346,6 +2406,7 @@ namespace ConsoleCommands {
         a_vm->RegisterFunction("ShowConfigMenu"sv, className, ShowConfigMenu);
         a_vm->RegisterFunction("HideConfigMenu"sv, className, HideConfigMenu);
         a_vm->RegisterFunction("ShowFontTest"sv, className, ShowFontTest);
+        a_vm->RegisterFunction("RunPipelineBenchmark"sv, className, RunPipelineBenchmark);
 
         // MCM Settings - General
         a_vm->RegisterFunction("GetModEnabled"sv, className, GetModEnabled);
@@ -2389,7 +2450,10 @@ namespace ConsoleCommands {
         a_vm->RegisterFunction("FormatTranslation"sv, className, FormatTranslation);
         a_vm->RegisterFunction("GetNetworkMasterName"sv, className, GetNetworkMasterName);
         a_vm->RegisterFunction("RunSort"sv, className, RunSort);
+        a_vm->RegisterFunction("RunSortAll"sv, className, RunSortAll);
         a_vm->RegisterFunction("RunSweep"sv, className, RunSweep);
+        a_vm->RegisterFunction("GetAutoRoute"sv, className, GetAutoRoute);
+        a_vm->RegisterFunction("SetAutoRoute"sv, className, SetAutoRoute);
         a_vm->RegisterFunction("GetNetworkContainerCount"sv, className, GetNetworkContainerCount);
         a_vm->RegisterFunction("GetNetworkContainerNames"sv, className, GetNetworkContainerNames);
         a_vm->RegisterFunction("RemoveContainerFromNetwork"sv, className, RemoveContainerFromNetwork);
@@ -86,6 +86,10 @@ public:
         };
     }
 
+    // Entries change only on events that invalidate the registry
+    bool CachePickerEntries() const override { return true; }
+    bool CacheOwnership() const override { return true; }
+
     std::vector<PickerEntry> GetPickerEntries(RE::FormID a_masterFormID) const override {
         std::vector<PickerEntry> entries;
         auto* mgr = NetworkManager::GetSingleton();
@@ -1,8 +1,9 @@
 #include "ContainerRegistry.h"
 #include "ContainerUtils.h"
+#include "InventoryCache.h"
 
 #include <algorithm>
-#include <set>
+#include <unordered_set>
 
 ContainerRegistry* ContainerRegistry::GetSingleton() {
     static ContainerRegistry instance;
@@ -17,6 +18,7 @@ void ContainerRegistry::Register(std::unique_ptr<IContainerSource> a_source) {
 
     m_sources.push_back(std::move(a_source));
     m_sorted = false;
+    InvalidateOwnership();
 }
 
 void ContainerRegistry::EnsureSorted() {
@@ -30,19 +32,73 @@ void ContainerRegistry::EnsureSorted() {
     m_sorted = true;
 }
 
-ContainerDisplay ContainerRegistry::Resolve(RE::FormID a_formID) const {
-    // Iterate sources in priority order, return first match
+void ContainerRegistry::InvalidateOwnership() {
+    m_epoch.fetch_add(1, std::memory_order_acq_rel);
+}
+
+int ContainerRegistry::FindOwner(RE::FormID a_formID) const {
     const_cast<ContainerRegistry*>(this)->EnsureSorted();
 
-    for (const auto& source : m_sources) {
-        if (source->OwnsContainer(a_formID)) {
-            auto display = source->Resolve(a_formID);
-            logger::debug("ContainerRegistry::Resolve: {:08X} -> '{}' via source '{}' (available={})",
-                         a_formID, display.name, source->GetSourceID(), display.available);
-            return display;
+    // Cell-scanned containers are claimed relative to the player's cell
+    auto* player = RE::PlayerCharacter::GetSingleton();
+    const RE::TESObjectCELL* cell = player ? player->GetParentCell() : nullptr;
+    auto epoch = GetOwnershipEpoch();
+
+    int cached = kUnclaimed;
+    bool hit = false;
+    {
+        std::lock_guard lock(m_ownerLock);
+        if (m_ownersEpoch != epoch || m_ownersCell != cell) {
+            m_owners.clear();
+            m_ownersEpoch = epoch;
+            m_ownersCell = cell;
+        } else if (auto it = m_owners.find(a_formID); it != m_owners.end()) {
+            cached = it->second;
+            hit = true;
         }
     }
 
+    // Sources are queried outside the lock — several take NetworkManager's
+    int owner = kUnclaimed;
+    if (hit) {
+        // Sources that claim without an invalidation (followers) and rank
+        // above the cached answer may have taken the container since
+        size_t end = cached == kUnclaimed ? m_sources.size() : static_cast<size_t>(cached);
+        for (size_t i = 0; i < end; ++i) {
+            if (!m_sources[i]->CacheOwnership() && m_sources[i]->OwnsContainer(a_formID)) {
+                owner = static_cast<int>(i);
+                break;
+            }
+        }
+        if (owner == kUnclaimed &&
+            (cached == kUnclaimed || m_sources[cached]->OwnsContainer(a_formID))) {
+            return cached;
+        }
+    }
+
+    for (size_t i = 0; owner == kUnclaimed && i < m_sources.size(); ++i) {
+        if (m_sources[i]->OwnsContainer(a_formID)) {
+            owner = static_cast<int>(i);
+        }
+    }
+
+    {
+        std::lock_guard lock(m_ownerLock);
+        // An invalidation during the scan may have made this answer stale
+        if (m_ownersEpoch == epoch && GetOwnershipEpoch() == epoch) {
+            m_owners.insert_or_assign(a_formID, owner);
+        }
+    }
+    return owner;
+}
+
+ContainerDisplay ContainerRegistry::Resolve(RE::FormID a_formID) const {
+    // Ownership comes from the index; display and availability are always fresh
+    int owner = FindOwner(a_formID);
+    if (owner != kUnclaimed) {
+        return m_sources[owner]->Resolve(a_formID);
+    }
+
     // Fallback for unclaimed FormIDs
     logger::debug("ContainerRegistry::Resolve: {:08X} -> unclaimed by all {} sources",
                  a_formID, m_sources.size());
@@ -58,56 +114,85 @@ ContainerDisplay ContainerRegistry::Resolve(RE::FormID a_formID) const {
 int ContainerRegistry::CountItems(RE::FormID a_formID) const {
     if (a_formID == 0) return 0;
 
+    int owner = FindOwner(a_formID);
+    if (owner != kUnclaimed) {
+        return m_sources[owner]->CountItems(a_formID);
+    }
+
+    // Unclaimed — fall back to default counting
+    return InventoryCache::CountItems(a_formID);
+}
+
+PickerList ContainerRegistry::BuildPickerList(RE::FormID a_masterFormID) const {
     const_cast<ContainerRegistry*>(this)->EnsureSorted();
 
-    for (const auto& source : m_sources) {
-        if (source->OwnsContainer(a_formID)) {
-            return source->CountItems(a_formID);
+    // Availability of refs outside the loaded area follows the player's cell
+    auto* player = RE::PlayerCharacter::GetSingleton();
+    const RE::TESObjectCELL* cell = player ? player->GetParentCell() : nullptr;
+    auto epoch = GetOwnershipEpoch();
+    std::lock_guard lock(m_pickerLock);
+
+    auto& model = m_pickerModels[a_masterFormID];
+    bool changed = !model.list || model.sources.size() != m_sources.size();
+    model.sources.resize(m_sources.size());
+    if (model.cell != cell) {
+        for (auto& cached : model.sources) cached.epoch = 0;
+        model.cell = cell;
+    }
+
+    size_t requeried = 0;
+    for (size_t i = 0; i < m_sources.size(); ++i) {
+        auto& cached = model.sources[i];
+        if (cached.epoch == epoch && m_sources[i]->CachePickerEntries()) continue;
+
+        auto entries = m_sources[i]->GetPickerEntries(a_masterFormID);
+        ++requeried;
+
+        // Remove non-persistent containers — they get evicted when their cell unloads
+        std::erase_if(entries, [](const PickerEntry& entry) {
+            if (entry.formID == 0) return false;  // "Pass" entry
+            auto* ref = RE::TESForm::LookupByID<RE::TESObjectREFR>(entry.formID);
+            return ref && ContainerUtils::IsNonPersistent(ref);
+        });
+
+        if (cached.epoch == 0 || entries != cached.entries) {
+            cached.entries = std::move(entries);
+            changed = true;
         }
+        cached.epoch = epoch;
     }
 
-    // Unclaimed — fall back to default counting
-    auto* ref = RE::TESForm::LookupByID<RE::TESObjectREFR>(a_formID);
-    if (!ref) return 0;
-    int count = 0;
-    auto inv = ref->GetInventory();
-    for (auto& [item, data] : inv) {
-        if (!item || data.first <= 0 || IsPhantomItem(item)) continue;
-        count += data.first;
+    if (changed) {
+        model.list = MergePickerModel(model);
     }
-    return count;
-}
 
-std::vector<PickerEntry> ContainerRegistry::BuildPickerList(RE::FormID a_masterFormID) const {
-    const_cast<ContainerRegistry*>(this)->EnsureSorted();
+    logger::debug("ContainerRegistry::BuildPickerList: {} entries, {}/{} sources re-queried{}",
+                  model.list->size(), requeried, m_sources.size(), changed ? "" : " (unchanged)");
+
+    return model.list;
+}
 
+PickerList ContainerRegistry::MergePickerModel(const PickerModel& a_model) const {
     std::vector<PickerEntry> result;
-    std::set<RE::FormID> seen;
+    std::unordered_set<RE::FormID> seen;
+
+    size_t total = 0;
+    for (const auto& source : a_model.sources) total += source.entries.size();
+    result.reserve(total);
+    seen.reserve(total);
 
     // Gather entries from all sources (already in priority order)
-    for (const auto& source : m_sources) {
-        auto entries = source->GetPickerEntries(a_masterFormID);
-        for (auto& entry : entries) {
+    for (const auto& source : a_model.sources) {
+        for (const auto& entry : source.entries) {
             // Deduplicate by FormID
             // Pass (formID=0) is special and should not be deduplicated
-            if (entry.formID != 0 && seen.count(entry.formID)) {
+            if (entry.formID != 0 && !seen.insert(entry.formID).second) {
                 continue;
             }
-            seen.insert(entry.formID);
-            result.push_back(std::move(entry));
+            result.push_back(entry);
         }
     }
 
-    // Remove non-persistent containers — they get evicted when their cell unloads
-    result.erase(
-        std::remove_if(result.begin(), result.end(),
-            [](const PickerEntry& entry) {
-                if (entry.formID == 0) return false;  // "Pass" entry
-                auto* ref = RE::TESForm::LookupByID<RE::TESObjectREFR>(entry.formID);
-                return ref && ContainerUtils::IsNonPersistent(ref);
-            }),
-        result.end());
-
     // Sort by group, then subGroup, then alphabetically within subGroup
     std::sort(result.begin(), result.end(),
         [](const PickerEntry& a, const PickerEntry& b) {
@@ -117,31 +202,25 @@ std::vector<PickerEntry> ContainerRegistry::BuildPickerList(RE::FormID a_masterF
         });
 
     // Inject non-selectable header entries before each new non-empty subGroup
-    {
-        std::vector<PickerEntry> withHeaders;
-        withHeaders.reserve(result.size() + 8);
-        std::string lastSubGroup;
-        uint8_t lastGroup = 255;
-        for (auto& entry : result) {
-            if (!entry.subGroup.empty() &&
-                (entry.subGroup != lastSubGroup || entry.group != lastGroup)) {
-                PickerEntry header;
-                header.name = entry.subGroup;
-                header.subGroup = entry.subGroup;
-                header.group = entry.group;
-                header.formID = 0;
-                header.enabled = false;
-                withHeaders.push_back(std::move(header));
-            }
-            lastSubGroup = entry.subGroup;
-            lastGroup = entry.group;
-            withHeaders.push_back(std::move(entry));
+    std::vector<PickerEntry> withHeaders;
+    withHeaders.reserve(result.size() + 8);
+    std::string lastSubGroup;
+    uint8_t lastGroup = 255;
+    for (auto& entry : result) {
+        if (!entry.subGroup.empty() &&
+            (entry.subGroup != lastSubGroup || entry.group != lastGroup)) {
+            PickerEntry header;
+            header.name = entry.subGroup;
+            header.subGroup = entry.subGroup;
+            header.group = entry.group;
+            header.formID = 0;
+            header.enabled = false;
+            withHeaders.push_back(std::move(header));
         }
-        result = std::move(withHeaders);
+        lastSubGroup = entry.subGroup;
+        lastGroup = entry.group;
+        withHeaders.push_back(std::move(entry));
     }
 
-    logger::debug("ContainerRegistry::BuildPickerList: {} entries from {} sources",
-                  result.size(), m_sources.size());
-
-    return result;
+    return std::make_shared<const std::vector<PickerEntry>>(std::move(withHeaders));
 }
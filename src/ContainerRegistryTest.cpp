@@ -125,7 +125,7 @@ namespace ContainerRegistryTest {
         {
             auto list = registry->BuildPickerList(0);
             bool foundTest = false;
-            for (const auto& entry : list) {
+            for (const auto& entry : *list) {
                 if (entry.name == "Test Entry" && entry.formID == kTestSourceID) {
                     foundTest = true;
                     break;
@@ -146,7 +146,7 @@ namespace ContainerRegistryTest {
             bool allOwned = true;
             RE::FormID failedID = 0;
 
-            for (const auto& entry : list) {
+            for (const auto& entry : *list) {
                 // Skip Pass entry (formID=0) and disabled entries
                 if (entry.formID == 0) continue;
                 if (!entry.enabled) continue;
@@ -5,89 +5,192 @@
 #include "SCIEIntegration.h"
 #include "TranslationService.h"
 
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
 namespace ContainerScanner {
 
-    std::vector<ScannedContainer> ScanCellContainers(RE::FormID a_excludeFormID) {
-        std::vector<ScannedContainer> result;
+    namespace {
+        // Last scan of the player's cell, before per-call filtering
+        struct CellScan {
+            const RE::TESObjectCELL* cell = nullptr;
+            RE::FormID cellFormID = 0;
+            std::vector<ScannedContainer> containers;
+        };
 
-        auto* player = RE::PlayerCharacter::GetSingleton();
-        if (!player) return result;
+        std::mutex s_lock;
+        std::optional<CellScan> s_scan;
 
-        auto* cell = player->GetParentCell();
-        if (!cell) return result;
-
-        std::string cellName;
-        if (cell->GetFullName() && cell->GetFullName()[0] != '\0') {
-            cellName = cell->GetFullName();
+        bool IsContainerRef(RE::TESObjectREFR* a_ref) {
+            auto* base = a_ref ? a_ref->GetBaseObject() : nullptr;
+            return base && base->Is(RE::FormType::Container);
         }
 
-        auto playerPos = player->GetPosition();
+        // A container joined or left a cell — drop the scan if it was ours
+        void OnContainerAttachChanged(RE::TESObjectREFR* a_ref) {
+            if (!IsContainerRef(a_ref)) return;
+            auto* cell = a_ref->GetParentCell();
 
-        cell->ForEachReferenceInRange(playerPos, 100000.0f, [&](RE::TESObjectREFR* a_ref) -> RE::BSContainer::ForEachResult {
-            if (!a_ref) {
-                return RE::BSContainer::ForEachResult::kContinue;
+            std::lock_guard lock(s_lock);
+            if (s_scan && (!cell || cell == s_scan->cell)) {
+                s_scan.reset();
             }
+        }
 
-            // Skip disabled/deleted
-            if (a_ref->IsDisabled() || a_ref->IsDeleted()) {
-                return RE::BSContainer::ForEachResult::kContinue;
+        class CellAttachDetachListener : public RE::BSTEventSink<RE::TESCellAttachDetachEvent> {
+        public:
+            static CellAttachDetachListener* GetSingleton() {
+                static CellAttachDetachListener singleton;
+                return &singleton;
             }
 
-            // Must have container data
-            if (!a_ref->GetContainer()) {
-                return RE::BSContainer::ForEachResult::kContinue;
+            RE::BSEventNotifyControl ProcessEvent(
+                const RE::TESCellAttachDetachEvent* a_event,
+                RE::BSTEventSource<RE::TESCellAttachDetachEvent>*) override {
+                if (a_event && a_event->reference) OnContainerAttachChanged(a_event->reference.get());
+                return RE::BSEventNotifyControl::kContinue;
             }
 
-            auto formID = a_ref->GetFormID();
+        private:
+            CellAttachDetachListener() = default;
+        };
 
-            // Skip the excluded container (typically the master)
-            if (formID == a_excludeFormID) {
-                return RE::BSContainer::ForEachResult::kContinue;
+        class MoveAttachDetachListener : public RE::BSTEventSink<RE::TESMoveAttachDetachEvent> {
+        public:
+            static MoveAttachDetachListener* GetSingleton() {
+                static MoveAttachDetachListener singleton;
+                return &singleton;
             }
 
-            // Safety heuristic: non-respawning containers are safe
-            // Player-owned containers are safe
-            // We include both for now; the picker shows all qualifying containers
-            auto* base = a_ref->GetBaseObject();
-            if (!base) {
-                return RE::BSContainer::ForEachResult::kContinue;
+            RE::BSEventNotifyControl ProcessEvent(
+                const RE::TESMoveAttachDetachEvent* a_event,
+                RE::BSTEventSource<RE::TESMoveAttachDetachEvent>*) override {
+                if (a_event && a_event->movedRef) OnContainerAttachChanged(a_event->movedRef.get());
+                return RE::BSEventNotifyControl::kContinue;
             }
 
-            auto* cont = base->As<RE::TESObjectCONT>();
-            if (!cont) {
-                return RE::BSContainer::ForEachResult::kContinue;
+        private:
+            MoveAttachDetachListener() = default;
+        };
+
+        CellScan ScanCell(RE::PlayerCharacter* a_player, RE::TESObjectCELL* a_cell) {
+            CellScan scan;
+            scan.cell = a_cell;
+            scan.cellFormID = a_cell->GetFormID();
+
+            std::string cellName;
+            if (a_cell->GetFullName() && a_cell->GetFullName()[0] != '\0') {
+                cellName = a_cell->GetFullName();
             }
 
-            // Check respawn flag — respawning containers are risky
-            bool respawns = cont->data.flags.any(RE::CONT_DATA::Flag::kRespawn);
-
-            // Check ownership
-            auto* owner = a_ref->GetOwner();
-            bool playerOwned = false;
-            if (owner) {
-                if (owner->GetFormID() == 0x14) {
-                    playerOwned = true;
-                } else if (auto* faction = owner->As<RE::TESFaction>()) {
-                    playerOwned = player->IsInFaction(faction);
+            // Many containers share an owning faction — ask the player once per faction
+            std::unordered_map<RE::TESFaction*, bool> factionMember;
+
+            auto playerPos = a_player->GetPosition();
+
+            a_cell->ForEachReferenceInRange(playerPos, 100000.0f, [&](RE::TESObjectREFR* a_ref) -> RE::BSContainer::ForEachResult {
+                if (!a_ref) {
+                    return RE::BSContainer::ForEachResult::kContinue;
                 }
-            }
 
-            // Include if: non-respawning OR player-owned
-            if (!respawns || playerOwned) {
-                std::string name = T("$SLID_Container");
-                if (base->GetName() && base->GetName()[0] != '\0') {
-                    name = base->GetName();
+                // Skip deleted; disabled refs are kept and filtered per call,
+                // since enabling one fires no attach event
+                if (a_ref->IsDeleted()) {
+                    return RE::BSContainer::ForEachResult::kContinue;
+                }
+
+                // Must have container data
+                if (!a_ref->GetContainer()) {
+                    return RE::BSContainer::ForEachResult::kContinue;
                 }
-                result.push_back({formID, name, cellName});
-            }
 
-            return RE::BSContainer::ForEachResult::kContinue;
-        });
+                // Safety heuristic: non-respawning containers are safe
+                // Player-owned containers are safe
+                // We include both for now; the picker shows all qualifying containers
+                auto* base = a_ref->GetBaseObject();
+                if (!base) {
+                    return RE::BSContainer::ForEachResult::kContinue;
+                }
+
+                auto* cont = base->As<RE::TESObjectCONT>();
+                if (!cont) {
+                    return RE::BSContainer::ForEachResult::kContinue;
+                }
 
-        logger::debug("ScanCellContainers: found {} containers in cell '{}'", result.size(), cellName);
+                // Check respawn flag — respawning containers are risky
+                bool respawns = cont->data.flags.any(RE::CONT_DATA::Flag::kRespawn);
+
+                // Check ownership
+                bool playerOwned = false;
+                if (respawns) {
+                    if (auto* owner = a_ref->GetOwner()) {
+                        if (owner->GetFormID() == 0x14) {
+                            playerOwned = true;
+                        } else if (auto* faction = owner->As<RE::TESFaction>()) {
+                            auto [it, inserted] = factionMember.try_emplace(faction, false);
+                            if (inserted) it->second = a_player->IsInFaction(faction);
+                            playerOwned = it->second;
+                        }
+                    }
+                }
+
+                // Include if: non-respawning OR player-owned
+                if (!respawns || playerOwned) {
+                    std::string name = T("$SLID_Container");
+                    if (base->GetName() && base->GetName()[0] != '\0') {
+                        name = base->GetName();
+                    }
+                    scan.containers.push_back({a_ref->GetFormID(), std::move(name), cellName});
+                }
+
+                return RE::BSContainer::ForEachResult::kContinue;
+            });
+
+            logger::debug("ScanCellContainers: scanned {} containers in cell '{}' ({} owning factions)",
+                          scan.containers.size(), cellName, factionMember.size());
+            return scan;
+        }
+    }
+
+    std::vector<ScannedContainer> ScanCellContainers(RE::FormID a_excludeFormID) {
+        std::vector<ScannedContainer> result;
+
+        auto* player = RE::PlayerCharacter::GetSingleton();
+        if (!player) return result;
+
+        auto* cell = player->GetParentCell();
+        if (!cell) return result;
+
+        std::lock_guard lock(s_lock);
+        if (!s_scan || s_scan->cell != cell || s_scan->cellFormID != cell->GetFormID()) {
+            s_scan = ScanCell(player, cell);
+        }
+
+        // Refs can be disabled or deleted without an attach/detach event
+        result.reserve(s_scan->containers.size());
+        for (const auto& sc : s_scan->containers) {
+            if (sc.formID == a_excludeFormID) continue;
+            auto* ref = RE::TESForm::LookupByID<RE::TESObjectREFR>(sc.formID);
+            if (!ref || ref->IsDisabled() || ref->IsDeleted()) continue;
+            result.push_back(sc);
+        }
         return result;
     }
 
+    void ClearCache() {
+        std::lock_guard lock(s_lock);
+        s_scan.reset();
+    }
+
+    void RegisterEventSinks() {
+        auto* holder = RE::ScriptEventSourceHolder::GetSingleton();
+        if (!holder) return;
+        holder->AddEventSink<RE::TESCellAttachDetachEvent>(CellAttachDetachListener::GetSingleton());
+        holder->AddEventSink<RE::TESMoveAttachDetachEvent>(MoveAttachDetachListener::GetSingleton());
+        logger::info("ContainerScanner: registered cell attach/detach listeners");
+    }
+
     std::pair<std::string, std::string> ResolveContainerInfo(RE::FormID a_formID) {
         // Delegate to ContainerRegistry
         auto display = ContainerRegistry::GetSingleton()->Resolve(a_formID);
@@ -96,6 +199,6 @@ namespace ContainerScanner {
 
     std::vector<PickerEntry> BuildContainerList(RE::FormID a_masterFormID, [[maybe_unused]] bool a_includeMaster) {
         // Delegate to ContainerRegistry
-        return ContainerRegistry::GetSingleton()->BuildPickerList(a_masterFormID);
+        return *ContainerRegistry::GetSingleton()->BuildPickerList(a_masterFormID);
     }
 }
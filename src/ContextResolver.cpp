@@ -3,6 +3,8 @@
 #include "NetworkManager.h"
 #include "VendorRegistry.h"
 
+#include <algorithm>
+
 namespace ContextResolver {
 
     namespace {
@@ -77,7 +79,7 @@ namespace ContextResolver {
             return actions;
         }
 
-        std::vector<ActionEntry> BuildAirActions() {
+        std::vector<ActionEntry> BuildAirActions(size_t a_networkCount) {
             std::vector<ActionEntry> actions = {
                 {Action::kOpen,      "$SLID_CtxOpen",      "$SLID_CtxOpenDesc"},
                 {Action::kWhoosh,    "$SLID_CtxWhoosh",    "$SLID_CtxWhooshDesc"},
@@ -89,6 +91,13 @@ namespace ContextResolver {
                 {Action::kDetect,    "$SLID_CtxDetect",    "$SLID_CtxDetectDesc"},
             };
 
+            // Sort All only means something with more than one Link
+            if (a_networkCount > 1) {
+                auto sort = std::find_if(actions.begin(), actions.end(),
+                                         [](const ActionEntry& a_entry) { return a_entry.action == Action::kSort; });
+                actions.insert(sort + 1, {Action::kSortAll, "$SLID_CtxSortAll", "$SLID_CtxSortAllDesc"});
+            }
+
             if (FilterRegistry::GetSingleton()->HasPendingChanges()) {
                 actions.push_back({Action::kReloadFilters, "$SLID_CtxReloadFilters", "$SLID_CtxReloadFiltersDesc"});
             }
@@ -115,7 +124,7 @@ namespace ContextResolver {
             result.context = Context::kAir;
             result.cyclableNetworks = names;
             result.networkName = names[0];
-            result.actions = BuildAirActions();
+            result.actions = BuildAirActions(names.size());
             logger::debug("ContextResolver: -> kAir ({} networks)", names.size());
             return result;
         }
@@ -130,7 +139,7 @@ namespace ContextResolver {
                 result.context = Context::kAir;
                 result.cyclableNetworks = names;
                 result.networkName = names[0];
-                result.actions = BuildAirActions();
+                result.actions = BuildAirActions(names.size());
             }
             logger::debug("ContextResolver: -> air (form not found)");
             return result;
@@ -152,7 +161,7 @@ namespace ContextResolver {
                 result.context = Context::kAir;
                 result.cyclableNetworks = names;
                 result.networkName = names[0];
-                result.actions = BuildAirActions();
+                result.actions = BuildAirActions(names.size());
             }
             logger::debug("ContextResolver: -> air (not a container, ref={}, getContainer={})",
                           ref != nullptr, ref ? (ref->GetContainer() != nullptr) : false);
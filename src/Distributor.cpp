@@ -1,11 +1,17 @@
 #include "Distributor.h"
 #include "ContainerRegistry.h"
 #include "FilterRegistry.h"
+#include "InventoryCache.h"
+#include "MoveExecutor.h"
 #include "NetworkManager.h"
+#include "RestockIndex.h"
+#include "TraitCache.h"
+#include "TranslationService.h"
 #include "VendorRegistry.h"
 #include "Settings.h"
 
-#include <map>
+#include <bit>
+#include <limits>
 #include <random>
 #include <set>
 
@@ -103,6 +109,19 @@ namespace Distributor {
         return sets;
     }
 
+    // Whole intervals elapsed since the last sale, each owing one batch.
+    // Capped so a months-long absence doesn't empty the sell container at once.
+    static int32_t OwedIntervals(float a_elapsed, float a_interval) {
+        if (a_interval <= 0.0f) return 1;
+        auto owed = static_cast<int64_t>(a_elapsed / a_interval);
+        return static_cast<int32_t>(std::clamp<int64_t>(owed, 1, std::max(1, Settings::iMaxCatchUpIntervals)));
+    }
+
+    static int32_t CatchUpCapacity(int32_t a_batchSize, int32_t a_intervals) {
+        return static_cast<int32_t>(std::min<int64_t>(static_cast<int64_t>(a_batchSize) * a_intervals,
+                                                      std::numeric_limits<int32_t>::max()));
+    }
+
     // Lazy-cached COBJSets — built once, cached for session
     static float RandomJitter() {
         static std::mt19937 rng{std::random_device{}()};
@@ -168,6 +187,237 @@ namespace Distributor {
         return result;
     }
 
+    // --- Routing table ---
+    // RunPipeline is first-match-wins over a fixed stage list, so for a given
+    // effective pipeline the claiming stage of a base object never changes.
+    // Decisions are memoized per master container. The table is keyed by the
+    // effective stages and the FilterRegistry generation: a SetFilterConfig
+    // edit, a container becoming (un)available, or a filter reload all show up
+    // as a key mismatch and drop the table. Decisions that involved a
+    // player-state trait (or a dynamic FF form) are stamped with the
+    // TraitCache generation and recomputed once per operation.
+
+    struct RouteDecision {
+        int32_t claimIndex = -1;              // -1 = no linked stage matched
+        std::vector<uint16_t> contestedBy;    // later linked stages that also matched
+        uint32_t generation = 0;              // 0 = stable, else TraitCache generation
+    };
+
+    struct RouteTable {
+        std::vector<FilterStage> stages;
+        std::vector<const IFilter*> filters;  // resolved once per rebuild, parallel to stages
+        uint32_t registryGeneration = 0;
+        std::unordered_map<RE::FormID, RouteDecision> decisions;
+
+        // Linked stages that can match each FormType, in pipeline order.
+        // bucketOf maps a FormType to its bucket; bucket 0 holds the untyped
+        // stages only (for types no linked filter declares).
+        std::array<uint8_t, 256> bucketOf{};
+        std::vector<std::vector<uint16_t>> buckets;
+    };
+
+    static std::mutex s_routeLock;
+    static std::unordered_map<RE::FormID, RouteTable> s_routeTables;
+
+    static bool SameStages(const std::vector<FilterStage>& a_lhs, const std::vector<FilterStage>& a_rhs) {
+        if (a_lhs.size() != a_rhs.size()) return false;
+        for (size_t i = 0; i < a_lhs.size(); ++i) {
+            if (a_lhs[i].containerFormID != a_rhs[i].containerFormID) return false;
+            if (a_lhs[i].filterID != a_rhs[i].filterID) return false;
+        }
+        return true;
+    }
+
+    static void BuildTypeBuckets(RouteTable& a_table) {
+        a_table.bucketOf.fill(0);
+        a_table.buckets.assign(1, {});
+
+        // One bucket per FormType declared by any linked filter
+        for (size_t i = 0; i < a_table.stages.size(); ++i) {
+            if (a_table.stages[i].containerFormID == 0 || !a_table.filters[i]) continue;
+            for (auto type : a_table.filters[i]->GetFormTypes()) {
+                auto& slot = a_table.bucketOf[static_cast<uint8_t>(type)];
+                if (slot == 0) {
+                    slot = static_cast<uint8_t>(a_table.buckets.size());
+                    a_table.buckets.emplace_back();
+                }
+            }
+        }
+
+        // Fill in pipeline order so first-match-wins is preserved per bucket
+        for (size_t i = 0; i < a_table.stages.size(); ++i) {
+            // Unlinked filters (Pass) are invisible to the pipeline
+            if (a_table.stages[i].containerFormID == 0 || !a_table.filters[i]) continue;
+
+            const auto& types = a_table.filters[i]->GetFormTypes();
+            if (types.empty()) {
+                for (auto& bucket : a_table.buckets) bucket.push_back(static_cast<uint16_t>(i));
+            } else {
+                for (auto type : types) {
+                    a_table.buckets[a_table.bucketOf[static_cast<uint8_t>(type)]].push_back(static_cast<uint16_t>(i));
+                }
+            }
+        }
+    }
+
+    // Caller must hold s_routeLock
+    static RouteTable& GetRouteTable(RE::FormID a_masterFormID, const std::vector<FilterStage>& a_filters) {
+        auto* registry = FilterRegistry::GetSingleton();
+        auto& table = s_routeTables[a_masterFormID];
+
+        if (table.registryGeneration != registry->GetGeneration() || !SameStages(table.stages, a_filters)) {
+            table.stages = a_filters;
+            table.registryGeneration = registry->GetGeneration();
+            table.decisions.clear();
+            table.filters.clear();
+            table.filters.reserve(a_filters.size());
+            for (const auto& stage : a_filters) {
+                table.filters.push_back(registry->Resolve(stage));
+            }
+            BuildTypeBuckets(table);
+            logger::debug("RouteTable: rebuilt for master {:08X} ({} stages)", a_masterFormID, a_filters.size());
+        }
+        return table;
+    }
+
+    // Caller must hold s_routeLock
+    static const RouteDecision& Decide(RouteTable& a_table, RE::TESBoundObject* a_item, uint32_t a_generation) {
+        auto formID = a_item->GetFormID();
+        auto [it, inserted] = a_table.decisions.try_emplace(formID);
+        auto& decision = it->second;
+        if (!inserted && (decision.generation == 0 || decision.generation == a_generation)) {
+            return decision;
+        }
+
+        decision.claimIndex = -1;
+        decision.contestedBy.clear();
+        bool isVolatile = (formID >> 24) == 0xFF;  // dynamic forms can reuse FormIDs
+
+        // Only stages whose FormType gate admits this item (plus untyped ones)
+        const auto& candidates = a_table.buckets[a_table.bucketOf[static_cast<uint8_t>(a_item->GetFormType())]];
+        for (auto i : candidates) {
+            auto* filter = a_table.filters[i];
+            if (filter->DependsOnPlayerState(a_item)) isVolatile = true;
+            if (!filter->Matches(a_item)) continue;
+
+            if (decision.claimIndex == -1) {
+                decision.claimIndex = static_cast<int32_t>(i);
+            } else {
+                decision.contestedBy.push_back(static_cast<uint16_t>(i));
+            }
+        }
+
+        decision.generation = isVolatile ? a_generation : 0;
+        return decision;
+    }
+
+    // --- Whoosh masks ---
+    // A network's Whoosh selection is compiled to a bitmask over dense filter
+    // indices. Per-item filter results are memoized as (known, value) bits
+    // over the same indices and shared by every network, so a Whoosh only
+    // calls Matches() for (item, filter) pairs it has never seen. Items whose
+    // result depends on player state are stamped with the TraitCache
+    // generation and re-evaluated once per operation, like route decisions.
+    // Game thread only.
+
+    struct WhooshMask {
+        std::unordered_set<std::string> source;  // whooshFilters this mask was compiled from
+        uint32_t registryGeneration = 0;
+        std::vector<uint64_t> bits;
+    };
+
+    struct FilterMatchBits {
+        std::vector<uint64_t> known;
+        std::vector<uint64_t> value;
+        uint32_t generation = 0;  // 0 = stable, else TraitCache generation
+    };
+
+    static std::unordered_map<std::string, WhooshMask> s_whooshMasks;
+    static std::unordered_map<RE::FormID, FilterMatchBits> s_filterMatchBits;
+    static uint32_t s_filterMatchRegistryGeneration = 0;
+
+    static const WhooshMask& GetWhooshMask(const std::string& a_networkName,
+                                           const std::unordered_set<std::string>& a_filters) {
+        auto* registry = FilterRegistry::GetSingleton();
+        auto& mask = s_whooshMasks[a_networkName];
+        if (mask.registryGeneration == registry->GetGeneration() && mask.source == a_filters) {
+            return mask;
+        }
+
+        mask.source = a_filters;
+        mask.registryGeneration = registry->GetGeneration();
+        mask.bits.assign((registry->GetFilters().size() + 63) / 64, 0);
+
+        // Family root filters are UI-only checkbox helpers — they toggle their
+        // children but should not participate in matching.  Only individually
+        // checked child filters determine what gets whooshed.  This prevents
+        // root filters (which have broad RequireAnyTrait unions and often lack
+        // FormType gates) from catching unrelated items via COBJ-based traits.
+        const auto& roots = registry->GetFamilyRoots();
+        for (const auto& filterID : a_filters) {
+            if (std::find(roots.begin(), roots.end(), filterID) != roots.end()) continue;
+            auto index = registry->GetFilterIndex(filterID);
+            if (index == FilterRegistry::kInvalidIndex) continue;
+            mask.bits[index / 64] |= uint64_t{1} << (index % 64);
+        }
+        return mask;
+    }
+
+    // First filter in a_mask that matches a_item, or kInvalidIndex.
+    static FilterRegistry::FilterIndex FirstWhooshMatch(const WhooshMask& a_mask, RE::TESBoundObject* a_item,
+                                                        uint32_t a_generation) {
+        auto* registry = FilterRegistry::GetSingleton();
+        if (s_filterMatchRegistryGeneration != registry->GetGeneration()) {
+            s_filterMatchBits.clear();
+            s_filterMatchRegistryGeneration = registry->GetGeneration();
+        }
+
+        auto formID = a_item->GetFormID();
+        auto& bits = s_filterMatchBits[formID];
+        if (bits.known.size() != a_mask.bits.size() ||
+            (bits.generation != 0 && bits.generation != a_generation)) {
+            bits.known.assign(a_mask.bits.size(), 0);
+            bits.value.assign(a_mask.bits.size(), 0);
+            bits.generation = 0;
+        }
+        bool isVolatile = (formID >> 24) == 0xFF;  // dynamic forms can reuse FormIDs
+
+        // Already-known hits answer without touching any filter
+        for (size_t w = 0; w < a_mask.bits.size(); ++w) {
+            if (auto hit = a_mask.bits[w] & bits.known[w] & bits.value[w]) {
+                return static_cast<FilterRegistry::FilterIndex>(w * 64 + std::countr_zero(hit));
+            }
+        }
+
+        for (size_t w = 0; w < a_mask.bits.size(); ++w) {
+            for (auto pending = a_mask.bits[w] & ~bits.known[w]; pending; pending &= pending - 1) {
+                auto index = static_cast<FilterRegistry::FilterIndex>(w * 64 + std::countr_zero(pending));
+                auto* filter = registry->GetFilterAt(index);
+                bool matched = filter && filter->Matches(a_item);
+                if (filter && filter->DependsOnPlayerState(a_item)) isVolatile = true;
+
+                auto bit = uint64_t{1} << (index % 64);
+                bits.known[w] |= bit;
+                if (matched) {
+                    bits.value[w] |= bit;
+                    if (isVolatile) bits.generation = a_generation;
+                    return index;
+                }
+            }
+        }
+        if (isVolatile) bits.generation = a_generation;
+        return FilterRegistry::kInvalidIndex;
+    }
+
+    void ClearRouteTables() {
+        {
+            std::lock_guard lock(s_routeLock);
+            s_routeTables.clear();
+        }
+        s_whooshMasks.clear();
+        s_filterMatchBits.clear();
+    }
+
     // --- Pipeline engine ---
     // Pure engine: trusts its inputs. No availability checks, no ContainerRegistry calls.
 
@@ -180,8 +430,6 @@ namespace Distributor {
         PipelineResult result;
         result.filterOutcomes.resize(a_filters.size());
 
-        auto* registry = FilterRegistry::GetSingleton();
-
         // Pre-resolve container refs if needed for route building
         std::vector<RE::TESObjectREFR*> filterRefs;
         if (a_resolveRefs) {
@@ -193,34 +441,31 @@ namespace Distributor {
             }
         }
 
+        std::lock_guard lock(s_routeLock);
+        auto& table = GetRouteTable(a_masterFormID, a_filters);
+        auto generation = TraitCache::GetGeneration();
+
         for (const auto& poolItem : a_pool) {
             if (!poolItem.item || poolItem.count <= 0) continue;
 
-            int firstMatch = -1;
-
-            for (size_t i = 0; i < a_filters.size(); ++i) {
-                // Unlinked filters (Pass) are invisible to the pipeline
-                if (a_filters[i].containerFormID == 0) continue;
-
-                auto* filter = registry->GetFilter(a_filters[i].filterID);
-                if (!filter || !filter->Matches(poolItem.item)) continue;
+            const auto& decision = Decide(table, poolItem.item, generation);
+            if (decision.claimIndex == -1) continue;
+
+            // First matching linked filter claims this item
+            auto claim = static_cast<size_t>(decision.claimIndex);
+            result.filterOutcomes[claim].claimedCount += poolItem.count;
+            if (a_filters[claim].containerFormID == a_masterFormID) {
+                logger::debug("  Keep: {}x {} claimed by '{}' (stays in master)",
+                             poolItem.count, poolItem.item->GetName(),
+                             a_filters[claim].filterID);
+            } else if (a_resolveRefs && filterRefs[claim]) {
+                result.routes.push_back({poolItem.item, poolItem.count, filterRefs[claim]});
+            }
 
-                if (firstMatch == -1) {
-                    // First matching linked filter claims this item
-                    firstMatch = static_cast<int>(i);
-                    result.filterOutcomes[i].claimedCount += poolItem.count;
-                    if (a_filters[i].containerFormID == a_masterFormID) {
-                        logger::debug("  Keep: {}x {} claimed by '{}' (stays in master)",
-                                     poolItem.count, poolItem.item->GetName(),
-                                     a_filters[i].filterID);
-                    } else if (a_resolveRefs && filterRefs[i]) {
-                        result.routes.push_back({poolItem.item, poolItem.count, filterRefs[i]});
-                    }
-                } else {
-                    // Subsequent matching filters: contested
-                    result.filterOutcomes[i].contestedCount += poolItem.count;
-                    result.filterOutcomes[i].contestedBy[static_cast<size_t>(firstMatch)] += poolItem.count;
-                }
+            // Subsequent matching filters: contested
+            for (auto i : decision.contestedBy) {
+                result.filterOutcomes[i].contestedCount += poolItem.count;
+                result.filterOutcomes[i].contestedBy[claim] += poolItem.count;
             }
         }
 
@@ -245,10 +490,8 @@ namespace Distributor {
             auto* containerRef = RE::TESForm::LookupByID<RE::TESObjectREFR>(containerID);
             if (!containerRef) continue;
 
-            auto inv = containerRef->GetInventory();
-            for (auto& [item, data] : inv) {
-                if (!item || data.first <= 0 || IsPhantomItem(item)) continue;
-                toGather.push_back({item, data.first, containerRef});
+            for (const auto& [item, count] : *InventoryCache::Get(containerID)) {
+                toGather.push_back({item, count, containerRef});
             }
         }
 
@@ -260,6 +503,8 @@ namespace Distributor {
                                      nullptr, a_masterRef);
             totalItems += entry.count;
         }
+        for (auto containerID : a_containers) InventoryCache::Invalidate(containerID);
+        InventoryCache::Invalidate(a_masterRef->GetFormID());
 
         logger::info("GatherToMaster: gathered {} items from {} containers in network '{}'",
                      totalItems, a_containers.size(), a_networkName);
@@ -281,6 +526,11 @@ namespace Distributor {
     }
 
     uint32_t GatherToMaster(const std::string& a_networkName) {
+        if (MoveExecutor::IsBusy()) {
+            logger::info("GatherToMaster: move job running, ignoring Sweep of '{}'", a_networkName);
+            return 0;
+        }
+
         auto* mgr = NetworkManager::GetSingleton();
         auto* net = mgr->FindNetwork(a_networkName);
         if (!net) {
@@ -299,81 +549,305 @@ namespace Distributor {
         return GatherToMasterImpl(a_networkName, masterRef, containers);
     }
 
-    DistributeResult Distribute(const std::string& a_networkName) {
-        DistributeResult result;
+    // Container display name for DistributeResult::perContainer
+    static std::string GetContainerDisplayName(RE::FormID a_formID) {
+        if (auto* ref = RE::TESForm::LookupByID<RE::TESObjectREFR>(a_formID)) {
+            if (auto* base = ref->GetBaseObject()) {
+                if (base->GetName() && base->GetName()[0] != '\0') {
+                    return base->GetName();
+                }
+            }
+        }
+        return "Container";
+    }
+
+    // Stage index -> target container (Keep stages point at master)
+    static std::vector<RE::FormID> BuildStageTargets(const EffectivePipeline& a_effective,
+                                                     RE::FormID a_masterFormID) {
+        std::vector<RE::FormID> targets(a_effective.filters.size(), a_masterFormID);
+        for (size_t i = 0; i < a_effective.filters.size(); ++i) {
+            if (a_effective.filters[i].containerFormID != 0) {
+                targets[i] = a_effective.filters[i].containerFormID;
+            }
+        }
+        return targets;
+    }
+
+    // Moves planned but not yet executed, per container and item. Sort All plans
+    // each Link against the same cached snapshots with earlier Links' moves
+    // layered on top, so a container shared by two Links isn't emptied twice.
+    using PlannedDeltas = std::unordered_map<RE::FormID, std::unordered_map<RE::TESBoundObject*, int32_t>>;
+
+    // Cached snapshot of a container as it will be once a_deltas have executed.
+    // Returns the shared snapshot untouched when nothing is planned for it.
+    static std::shared_ptr<const InventoryCache::Snapshot> GetPlannedInventory(
+        RE::FormID a_formID, const PlannedDeltas* a_deltas) {
+
+        auto snapshot = InventoryCache::Get(a_formID);
+        if (!a_deltas) return snapshot;
+        auto it = a_deltas->find(a_formID);
+        if (it == a_deltas->end()) return snapshot;
+
+        auto pending = it->second;
+        auto planned = std::make_shared<InventoryCache::Snapshot>();
+        planned->reserve(snapshot->size() + pending.size());
+        for (const auto& [item, count] : *snapshot) {
+            int32_t plannedCount = count;
+            if (auto delta = pending.find(item); delta != pending.end()) {
+                plannedCount += delta->second;
+                pending.erase(delta);
+            }
+            if (plannedCount > 0) planned->push_back({item, plannedCount});
+        }
+        for (const auto& [item, delta] : pending) {
+            if (delta > 0) planned->push_back({item, delta});
+        }
+        return planned;
+    }
+
+    static void AddPlannedMoves(const std::vector<MoveExecutor::Move>& a_moves, PlannedDeltas& a_deltas) {
+        for (const auto& move : a_moves) {
+            a_deltas[move.sourceFormID][move.item] -= move.count;
+            a_deltas[move.targetFormID][move.item] += move.count;
+        }
+    }
+
+    // Delta plan: route every stack where it currently lives and move only the
+    // ones whose current container differs from their target, directly
+    // source -> target. Same final placement as gather + distribute, but an
+    // already-sorted network costs one inventory read per container and no moves.
+    static std::vector<MoveExecutor::Move> PlanDeltaSort(
+        const std::string& a_networkName,
+        RE::TESObjectREFR* a_masterRef,
+        const EffectivePipeline& a_effective,
+        const PlannedDeltas* a_deltas) {
+
+        auto masterFormID = a_masterRef->GetFormID();
+
+        std::vector<RE::TESObjectREFR*> containerRefs{a_masterRef};
+        for (auto formID : CollectActiveContainers(a_effective, masterFormID)) {
+            if (auto* ref = RE::TESForm::LookupByID<RE::TESObjectREFR>(formID)) {
+                containerRefs.push_back(ref);
+            }
+        }
+
+        auto stageTargets = BuildStageTargets(a_effective, masterFormID);
+
+        std::vector<MoveExecutor::Move> moves;
+        size_t stackCount = 0;
+
+        std::lock_guard lock(s_routeLock);
+        auto& table = GetRouteTable(masterFormID, a_effective.filters);
+        auto generation = TraitCache::GetGeneration();
+
+        for (auto* source : containerRefs) {
+            auto sourceFormID = source->GetFormID();
+            for (const auto& [item, count] : *GetPlannedInventory(sourceFormID, a_deltas)) {
+                ++stackCount;
+
+                const auto& decision = Decide(table, item, generation);
+                auto target = decision.claimIndex == -1
+                    ? masterFormID
+                    : stageTargets[static_cast<size_t>(decision.claimIndex)];
+                if (target != sourceFormID) {
+                    moves.push_back({item, count, sourceFormID, target});
+                }
+            }
+        }
+
+        logger::info("Sort: {} of {} stacks misplaced in network '{}'",
+                     moves.size(), stackCount, a_networkName);
+        return moves;
+    }
+
+    // Full plan: gather every stack from the linked containers to master, then
+    // route the pooled contents of master out through the pipeline.
+    static std::vector<MoveExecutor::Move> PlanFullSort(
+        const std::string& a_networkName,
+        RE::TESObjectREFR* a_masterRef,
+        const EffectivePipeline& a_effective,
+        const PlannedDeltas* a_deltas) {
+
+        auto masterFormID = a_masterRef->GetFormID();
+        std::vector<MoveExecutor::Move> moves;
 
+        // Phase 1: gather moves, pooling counts as if already in master
+        std::vector<PoolItem> pool;
+        std::unordered_map<RE::TESBoundObject*, size_t> poolIndex;
+        auto addToPool = [&](RE::TESBoundObject* a_item, int32_t a_count) {
+            auto [it, inserted] = poolIndex.try_emplace(a_item, pool.size());
+            if (inserted) {
+                pool.push_back({a_item, a_count});
+            } else {
+                pool[it->second].count += a_count;
+            }
+        };
+
+        for (const auto& [item, count] : *GetPlannedInventory(masterFormID, a_deltas)) {
+            addToPool(item, count);
+        }
+
+        for (auto containerID : CollectActiveContainers(a_effective, masterFormID)) {
+            for (const auto& [item, count] : *GetPlannedInventory(containerID, a_deltas)) {
+                moves.push_back({item, count, containerID, masterFormID, true});
+                addToPool(item, count);
+            }
+        }
+        logger::debug("  Pool: {} items for master {:08X} ({} gather moves)",
+                     pool.size(), masterFormID, moves.size());
+
+        // Phase 2: route moves out of master
+        auto pipelineResult = RunPipeline(a_effective.filters, masterFormID, pool, true);
+        for (const auto& route : pipelineResult.routes) {
+            moves.push_back({route.item, route.count, masterFormID, route.target->GetFormID()});
+        }
+
+        logger::info("Sort: {} moves planned for network '{}'", moves.size(), a_networkName);
+        return moves;
+    }
+
+    // Resolve the network and build the Sort move plan. Returns false if the
+    // network or master can't be resolved. Callers invalidate volatile traits.
+    static bool PlanSort(const std::string& a_networkName,
+                         std::vector<MoveExecutor::Move>& a_moves,
+                         const PlannedDeltas* a_deltas = nullptr) {
         auto* mgr = NetworkManager::GetSingleton();
         auto* net = mgr->FindNetwork(a_networkName);
         if (!net) {
             logger::error("Distribute: network '{}' not found", a_networkName);
-            return result;
+            return false;
         }
 
         auto* masterRef = RE::TESForm::LookupByID<RE::TESObjectREFR>(net->masterFormID);
         if (!masterRef) {
             logger::error("Distribute: master container {:08X} not found", net->masterFormID);
-            return result;
+            return false;
         }
 
         // Resolve availability once — used by both gather and pipeline
         auto effective = ResolveEffectivePipeline(net->filters, net->masterFormID);
 
-        // Phase 1: Gather all items from effective containers to master
-        auto containers = CollectActiveContainers(effective, net->masterFormID);
-        GatherToMasterImpl(a_networkName, masterRef, containers);
+        a_moves = Settings::bDeltaSort
+            ? PlanDeltaSort(a_networkName, masterRef, effective, a_deltas)
+            : PlanFullSort(a_networkName, masterRef, effective, a_deltas);
+        return true;
+    }
 
-        // Phase 2: Build pool from master inventory
-        std::vector<PoolItem> pool;
-        auto masterInv = masterRef->GetInventory();
-        for (auto& [item, data] : masterInv) {
-            if (!item || data.first <= 0) continue;
-            if (IsPhantomItem(item)) {
-                logger::debug("  Phantom skip: {} (FormID {:08X}, type {}, playable={})",
-                             item->GetName() ? item->GetName() : "(null)",
-                             item->GetFormID(),
-                             static_cast<int>(item->GetFormType()),
-                             item->GetPlayable());
-                continue;
-            }
-            pool.push_back({item, data.first});
+    // Full mode's gather moves are tagged staging and already left out of perTarget.
+    static DistributeResult ToDistributeResult(const MoveExecutor::Result& a_moved) {
+        DistributeResult result;
+        result.cancelled = a_moved.cancelled;
+        for (const auto& [targetFormID, count] : a_moved.perTarget) {
+            result.totalItems += count;
+            result.perContainer.emplace_back(GetContainerDisplayName(targetFormID), count);
         }
-        logger::debug("  Pool: {} items from master {:08X} (inv size {})",
-                     pool.size(), net->masterFormID, masterInv.size());
+        return result;
+    }
 
-        // Phase 3: Run pipeline (effective filters — unavailable containers already zeroed)
-        auto pipelineResult = RunPipeline(effective.filters,
-                                          net->masterFormID, pool, true);
+    DistributeResult Distribute(const std::string& a_networkName) {
+        if (MoveExecutor::IsBusy()) {
+            logger::info("Distribute: move job running, ignoring Sort of '{}'", a_networkName);
+            return {};
+        }
 
-        // Phase 4: Execute routes
-        std::map<RE::TESObjectREFR*, uint32_t> perContainerCount;
-        for (const auto& route : pipelineResult.routes) {
-            logger::debug("  Moving {}x {} -> {:08X}",
-                         route.count,
-                         route.item->GetName(),
-                         route.target->GetFormID());
+        // Player-state traits (unread books, unknown spells) may have changed since last run
+        TraitCache::InvalidateVolatile();
+
+        std::vector<MoveExecutor::Move> moves;
+        if (!PlanSort(a_networkName, moves)) return {};
 
-            masterRef->RemoveItem(route.item, route.count, RE::ITEM_REMOVE_REASON::kStoreInContainer,
-                                  nullptr, route.target);
-            result.totalItems += route.count;
-            perContainerCount[route.target] += route.count;
+        auto result = ToDistributeResult(MoveExecutor::RunNow(moves));
+        logger::info("Sort: distributed {} items in network '{}'", result.totalItems, a_networkName);
+        return result;
+    }
+
+    bool DistributeAsync(const std::string& a_networkName,
+                         std::function<void(const DistributeResult&)> a_onComplete,
+                         MoveExecutor::ProgressCallback a_onProgress) {
+        if (MoveExecutor::IsBusy()) {
+            logger::info("DistributeAsync: move job already running, ignoring Sort of '{}'", a_networkName);
+            return false;
         }
 
-        // Build per-container result with names
-        for (const auto& [containerRef, count] : perContainerCount) {
-            std::string name = "Container";
-            if (auto* base = containerRef->GetBaseObject()) {
-                if (base->GetName() && base->GetName()[0] != '\0') {
-                    name = base->GetName();
-                }
-            }
-            result.perContainer.emplace_back(name, count);
+        TraitCache::InvalidateVolatile();
+
+        std::vector<MoveExecutor::Move> moves;
+        if (!PlanSort(a_networkName, moves)) return false;
+
+        auto onComplete = [a_networkName, a_onComplete](const MoveExecutor::Result& a_moved) {
+            auto result = ToDistributeResult(a_moved);
+            logger::info("Sort: distributed {} items in network '{}'{}", result.totalItems, a_networkName,
+                         result.cancelled ? " (interrupted)" : "");
+            if (a_onComplete) a_onComplete(result);
+        };
+
+        return MoveExecutor::Submit(std::move(moves), std::move(onComplete), std::move(a_onProgress));
+    }
+
+    MoveExecutor::ProgressCallback MakeSortProgressNotifier() {
+        auto lastNotify = std::make_shared<std::chrono::steady_clock::time_point>(std::chrono::steady_clock::now());
+        return [lastNotify](const MoveExecutor::Progress& a_progress) {
+            auto now = std::chrono::steady_clock::now();
+            if (now - *lastNotify < std::chrono::seconds(1)) return;
+            *lastNotify = now;
+            auto percent = a_progress.movesDone * 100 / a_progress.movesTotal;
+            RE::DebugNotification(TF("$SLID_NotifySorting", std::to_string(percent)).c_str());
+        };
+    }
+
+    // Plan every Link in order, each seeing the moves of the Links before it.
+    // Returns the number of networks planned.
+    static size_t PlanSortAll(std::vector<MoveExecutor::Move>& a_moves) {
+        TraitCache::InvalidateVolatile();
+
+        PlannedDeltas deltas;
+        size_t planned = 0;
+        for (const auto& name : NetworkManager::GetSingleton()->GetNetworkNames()) {
+            std::vector<MoveExecutor::Move> moves;
+            if (!PlanSort(name, moves, &deltas)) continue;
+
+            AddPlannedMoves(moves, deltas);
+            a_moves.insert(a_moves.end(), moves.begin(), moves.end());
+            ++planned;
         }
+        logger::info("Sort All: {} moves planned across {} networks", a_moves.size(), planned);
+        return planned;
+    }
 
-        logger::info("Sort: distributed {} items in network '{}'", result.totalItems, a_networkName);
+    DistributeResult DistributeAll() {
+        if (MoveExecutor::IsBusy()) {
+            logger::info("DistributeAll: move job running, ignoring Sort All");
+            return {};
+        }
 
+        std::vector<MoveExecutor::Move> moves;
+        PlanSortAll(moves);
+
+        auto result = ToDistributeResult(MoveExecutor::RunNow(moves));
+        logger::info("Sort All: distributed {} items", result.totalItems);
         return result;
     }
 
+    bool DistributeAllAsync(std::function<void(const DistributeResult&)> a_onComplete,
+                            MoveExecutor::ProgressCallback a_onProgress) {
+        if (MoveExecutor::IsBusy()) {
+            logger::info("DistributeAllAsync: move job already running, ignoring Sort All");
+            return false;
+        }
+
+        std::vector<MoveExecutor::Move> moves;
+        if (PlanSortAll(moves) == 0) return false;
+
+        auto onComplete = [a_onComplete](const MoveExecutor::Result& a_moved) {
+            auto result = ToDistributeResult(a_moved);
+            logger::info("Sort All: distributed {} items{}", result.totalItems,
+                         result.cancelled ? " (interrupted)" : "");
+            if (a_onComplete) a_onComplete(result);
+        };
+
+        return MoveExecutor::Submit(std::move(moves), std::move(onComplete), std::move(a_onProgress));
+    }
+
     PredictionResult PredictDistribution(
         RE::FormID a_masterFormID,
         const std::vector<FilterStage>& a_filters) {
@@ -383,6 +857,8 @@ namespace Distributor {
         result.contestedCounts.resize(a_filters.size(), 0);
         result.contestedByMaps.resize(a_filters.size());
 
+        TraitCache::InvalidateVolatile();
+
         // Resolve availability once
         auto effective = ResolveEffectivePipeline(a_filters, a_masterFormID);
 
@@ -395,12 +871,8 @@ namespace Distributor {
         // Build item pool from all effective containers (simulates GatherToMaster)
         std::vector<PoolItem> pool;
         for (auto formID : allContainers) {
-            auto* ref = RE::TESForm::LookupByID<RE::TESObjectREFR>(formID);
-            if (!ref) continue;
-            auto inv = ref->GetInventory();
-            for (auto& [item, data] : inv) {
-                if (!item || data.first <= 0 || IsPhantomItem(item)) continue;
-                pool.push_back({item, data.first});
+            for (const auto& [item, count] : *InventoryCache::Get(formID)) {
+                pool.push_back({item, count});
             }
         }
 
@@ -419,7 +891,159 @@ namespace Distributor {
         return result;
     }
 
+    DistributeResult RouteDeposits(const std::string& a_networkName, const std::vector<PoolItem>& a_deposits) {
+        auto* mgr = NetworkManager::GetSingleton();
+        auto* net = mgr->FindNetwork(a_networkName);
+        if (!net) {
+            logger::error("RouteDeposits: network '{}' not found", a_networkName);
+            return {};
+        }
+
+        auto masterFormID = net->masterFormID;
+        TraitCache::InvalidateVolatile();
+        auto effective = ResolveEffectivePipeline(net->filters, masterFormID);
+        auto stageTargets = BuildStageTargets(effective, masterFormID);
+
+        // Never move more than master still holds (player may have taken some back)
+        std::unordered_map<RE::TESBoundObject*, int32_t> inMaster;
+        for (const auto& [item, count] : *InventoryCache::Get(masterFormID)) {
+            inMaster[item] += count;
+        }
+
+        std::vector<MoveExecutor::Move> moves;
+        {
+            std::lock_guard lock(s_routeLock);
+            auto& table = GetRouteTable(masterFormID, effective.filters);
+            auto generation = TraitCache::GetGeneration();
+
+            for (const auto& deposit : a_deposits) {
+                auto it = inMaster.find(deposit.item);
+                if (it == inMaster.end() || it->second <= 0) continue;
+
+                const auto& decision = Decide(table, deposit.item, generation);
+                if (decision.claimIndex == -1) continue;
+                auto target = stageTargets[static_cast<size_t>(decision.claimIndex)];
+                if (target == masterFormID) continue;
+
+                int32_t count = std::min(deposit.count, it->second);
+                it->second -= count;
+                moves.push_back({deposit.item, count, masterFormID, target});
+            }
+        }
+
+        auto result = ToDistributeResult(MoveExecutor::RunNow(moves));
+        logger::info("RouteDeposits: routed {} of {} deposited stacks ({} items) in network '{}'",
+                     moves.size(), a_deposits.size(), result.totalItems, a_networkName);
+        return result;
+    }
+
+    // --- Prediction session ---
+
+    void PredictionSession::Reset() {
+        m_items.clear();
+        m_itemIndex.clear();
+        m_containers.clear();
+        m_matchColumns.clear();
+    }
+
+    const PredictionSession::ContainerSnapshot& PredictionSession::GetContainer(RE::FormID a_formID) {
+        auto it = m_containers.find(a_formID);
+        if (it != m_containers.end()) return it->second;
+
+        auto& snapshot = m_containers[a_formID];
+        for (const auto& [item, count] : *InventoryCache::Get(a_formID)) {
+            auto [idxIt, inserted] = m_itemIndex.try_emplace(item, static_cast<uint32_t>(m_items.size()));
+            if (inserted) m_items.push_back(item);
+            snapshot.items.emplace_back(idxIt->second, count);
+        }
+        return snapshot;
+    }
+
+    const std::vector<uint8_t>& PredictionSession::GetMatchColumn(const std::string& a_filterID) {
+        auto& column = m_matchColumns[a_filterID];
+        if (column.size() == m_items.size()) return column;
+
+        // Match only items captured since this column was last extended
+        auto* filter = FilterRegistry::GetSingleton()->GetFilter(a_filterID);
+        size_t start = column.size();
+        column.resize(m_items.size(), 0);
+        for (size_t i = start; i < m_items.size(); ++i) {
+            column[i] = (filter && filter->Matches(m_items[i])) ? 1 : 0;
+        }
+        return column;
+    }
+
+    PredictionResult PredictionSession::Predict(const std::vector<FilterStage>& a_filters) {
+        PredictionResult result;
+        result.filterCounts.resize(a_filters.size(), 0);
+        result.contestedCounts.resize(a_filters.size(), 0);
+        result.contestedByMaps.resize(a_filters.size());
+
+        auto epoch = InventoryCache::GetEpoch();
+        if (epoch != m_inventoryEpoch) {
+            if (!m_containers.empty()) {
+                logger::debug("PredictionSession: container contents changed, discarding snapshot");
+            }
+            Reset();
+            m_inventoryEpoch = epoch;
+            TraitCache::InvalidateVolatile();
+        }
+
+        // Resolve availability once
+        auto effective = ResolveEffectivePipeline(a_filters, m_masterFormID);
+
+        // Pool counts per item across master + all available pipeline containers
+        std::set<RE::FormID> allContainers;
+        if (m_masterFormID != 0) allContainers.insert(m_masterFormID);
+        auto pipelineContainers = CollectActiveContainers(effective, m_masterFormID);
+        allContainers.insert(pipelineContainers.begin(), pipelineContainers.end());
+
+        std::vector<const ContainerSnapshot*> snapshots;
+        for (auto formID : allContainers) {
+            snapshots.push_back(&GetContainer(formID));
+        }
+
+        std::vector<int32_t> pooled(m_items.size(), 0);
+        for (const auto* snapshot : snapshots) {
+            for (const auto& [index, count] : snapshot->items) {
+                pooled[index] += count;
+            }
+        }
+
+        // Match columns for linked stages only (Pass is invisible to the pipeline)
+        std::vector<const std::vector<uint8_t>*> columns(effective.filters.size(), nullptr);
+        for (size_t i = 0; i < effective.filters.size(); ++i) {
+            if (effective.filters[i].containerFormID == 0) continue;
+            columns[i] = &GetMatchColumn(effective.filters[i].filterID);
+        }
+
+        // First match over cached bits
+        for (size_t item = 0; item < pooled.size(); ++item) {
+            int32_t count = pooled[item];
+            if (count <= 0) continue;
+
+            int firstMatch = -1;
+            for (size_t i = 0; i < columns.size(); ++i) {
+                if (!columns[i] || !(*columns[i])[item]) continue;
+                if (firstMatch == -1) {
+                    firstMatch = static_cast<int>(i);
+                    result.filterCounts[i] += count;
+                } else {
+                    result.contestedCounts[i] += count;
+                    result.contestedByMaps[i][static_cast<size_t>(firstMatch)] += count;
+                }
+            }
+        }
+
+        return result;
+    }
+
     uint32_t Whoosh(const std::string& a_networkName) {
+        if (MoveExecutor::IsBusy()) {
+            logger::info("Whoosh: move job running, ignoring Whoosh of '{}'", a_networkName);
+            return 0;
+        }
+
         auto* mgr = NetworkManager::GetSingleton();
         auto* net = mgr->FindNetwork(a_networkName);
         if (!net) {
@@ -444,38 +1068,21 @@ namespace Distributor {
         }
 
         auto* registry = FilterRegistry::GetSingleton();
+        TraitCache::InvalidateVolatile();
+        auto generation = TraitCache::GetGeneration();
+        const auto& mask = GetWhooshMask(a_networkName, net->whooshFilters);
 
-        // Build worn set: biped slots AND IsWorn() must agree.  Either source alone
+        // Worn items: biped slots AND IsWorn() must agree.  Either source alone
         // can have false positives (stale ExtraWorn from multi-equip mods, or ghost
-        // biped refs for items no longer in inventory).
-        std::set<RE::FormID> equippedForms;
-        {
-            std::set<RE::FormID> bipedForms;
-            auto& runtimeData = player->GetActorRuntimeData();
-            if (auto biped = runtimeData.biped) {
-                for (std::uint32_t slot = 0; slot < RE::BIPED_OBJECTS::kTotal; ++slot) {
-                    if (auto* form = biped->objects[slot].item) {
-                        bipedForms.insert(form->GetFormID());
-                    }
+        // biped refs for items no longer in inventory).  IsWorn() is checked in
+        // the drain pass below, so the inventory is only built once.
+        std::set<RE::FormID> bipedForms;
+        if (auto biped = player->GetActorRuntimeData().biped) {
+            for (std::uint32_t slot = 0; slot < RE::BIPED_OBJECTS::kTotal; ++slot) {
+                if (auto* form = biped->objects[slot].item) {
+                    bipedForms.insert(form->GetFormID());
                 }
             }
-            auto playerInvWorn = player->GetInventory();
-            for (auto& [itm, d] : playerInvWorn) {
-                if (!itm || d.first <= 0) continue;
-                if (d.second->IsWorn() && bipedForms.contains(itm->GetFormID())) {
-                    equippedForms.insert(itm->GetFormID());
-                }
-            }
-        }
-
-        // Family root filters are UI-only checkbox helpers — they toggle their
-        // children but should not participate in matching.  Only individually
-        // checked child filters determine what gets whooshed.  This prevents
-        // root filters (which have broad RequireAnyTrait unions and often lack
-        // FormType gates) from catching unrelated items via COBJ-based traits.
-        std::unordered_set<std::string> effectiveFilters = net->whooshFilters;
-        for (const auto& rootID : registry->GetFamilyRoots()) {
-            effectiveFilters.erase(rootID);
         }
 
         struct MoveEntry {
@@ -491,7 +1098,7 @@ namespace Distributor {
             auto& invData = data.second;
 
             if (invData->IsQuestObject()) continue;
-            if (equippedForms.contains(item->GetFormID())) continue;
+            if (invData->IsWorn() && bipedForms.contains(item->GetFormID())) continue;
             if (invData->IsFavorited()) continue;
 
             if (item->IsGold()) continue;
@@ -499,18 +1106,10 @@ namespace Distributor {
             if (item->GetFormType() == RE::FormType::Light) continue;
 
             // Item drains if ANY enabled filter matches
-            bool shouldDrain = false;
-            for (const auto& filterID : effectiveFilters) {
-                auto* filter = registry->GetFilter(filterID);
-                if (filter && filter->Matches(item)) {
-                    shouldDrain = true;
-                    logger::debug("  Whoosh check: {} matched filter '{}'",
-                                 item->GetName(), filterID);
-                    break;
-                }
-            }
-
-            if (shouldDrain) {
+            auto matched = FirstWhooshMatch(mask, item, generation);
+            if (matched != FilterRegistry::kInvalidIndex) {
+                logger::debug("  Whoosh check: {} matched filter '{}'",
+                             item->GetName(), registry->GetFilterAt(matched)->GetID());
                 toMove.push_back({item, data.first});
             }
         }
@@ -523,6 +1122,10 @@ namespace Distributor {
                                nullptr, masterRef);
             movedCount += entry.count;
         }
+        if (!toMove.empty()) {
+            InventoryCache::Invalidate(player->GetFormID());
+            InventoryCache::Invalidate(net->masterFormID);
+        }
 
         logger::info("Whoosh: moved {} items ({} stacks) from player to master {:08X} in network '{}'",
                      movedCount, toMove.size(), net->masterFormID, a_networkName);
@@ -530,68 +1133,63 @@ namespace Distributor {
         return movedCount;
     }
 
-    RestockResult Restock(const std::string& a_networkName) {
-        RestockResult result;
+    RestockPlan PlanRestock(const std::string& a_networkName, const RestockCategory::RestockConfig& a_config) {
+        RestockPlan plan;
 
         auto* mgr = NetworkManager::GetSingleton();
         auto* net = mgr->FindNetwork(a_networkName);
         if (!net) {
             logger::error("Restock: network '{}' not found", a_networkName);
-            return result;
-        }
-
-        if (!net->restockConfig.configured) {
-            return result;
+            return plan;
         }
 
         auto* player = RE::PlayerCharacter::GetSingleton();
         if (!player) {
             logger::error("Restock: player not available");
-            return result;
+            return plan;
         }
 
-        const auto& config = net->restockConfig;
+        const auto& categories = RestockCategory::GetAllCategories();
+
+        // Target quantity per category index (0 = not enabled)
+        std::vector<int32_t> target(categories.size(), 0);
+        for (const auto& [catID, targetQty] : a_config.itemQuantities) {
+            auto index = RestockCategory::GetCategoryIndex(catID);
+            if (index != RestockCategory::kNoCategory) target[index] = static_cast<int32_t>(targetQty);
+        }
 
         // Step 1: Count player inventory per enabled restock category
-        std::unordered_map<std::string, int32_t> playerCounts;
-        {
-            auto playerInv = player->GetInventory();
-            for (auto& [item, data] : playerInv) {
-                if (!item || data.first <= 0 || IsPhantomItem(item)) continue;
-                auto catID = RestockCategory::Classify(item);
-                if (!catID.empty() && config.itemQuantities.count(catID) > 0) {
-                    playerCounts[catID] += data.first;
-                }
-            }
+        std::vector<int32_t> playerCounts(categories.size(), 0);
+        for (const auto& [index, count] : RestockIndex::Get(player->GetFormID()).totals) {
+            playerCounts[index] = count;
         }
 
         // Step 2: Compute deficit per enabled category (direct lookup — each item has its own qty)
-        std::unordered_map<std::string, int32_t> deficit;
-        {
-            for (const auto& [catID, targetQty] : config.itemQuantities) {
-                int32_t target = static_cast<int32_t>(targetQty);
-                int32_t current = playerCounts.count(catID) ? playerCounts[catID] : 0;
-                int32_t need = target - current;
-                if (need > 0) {
-                    deficit[catID] = need;
-                    logger::debug("Restock: category '{}' needs {} (target={}, current={})",
-                                  catID, need, target, current);
-                }
+        std::vector<int32_t> deficit(categories.size(), 0);
+        RestockIndex::CategoryMask deficitMask;
+        for (size_t i = 0; i < categories.size(); ++i) {
+            int32_t need = target[i] - playerCounts[i];
+            if (target[i] > 0 && need > 0) {
+                deficit[i] = need;
+                deficitMask.set(i);
+                logger::debug("Restock: category '{}' needs {} (target={}, current={})",
+                              categories[i].id, need, target[i], playerCounts[i]);
             }
         }
 
-        if (deficit.empty()) {
-            logger::info("Restock: nothing needed in network '{}'", a_networkName);
-            return result;
+        if (deficitMask.none()) {
+            return plan;
         }
 
         // Step 3: Scan ALL Link containers for candidate items
         struct Candidate {
             RE::TESBoundObject* item;
             int32_t count;
-            RE::TESObjectREFR* sourceRef;
-            std::string categoryID;
+            RE::FormID sourceFormID;
+            RestockCategory::CategoryIndex category;
             float qualityScore;
+            bool sourceLoaded;
+            int32_t sourceSupply;  // items this container holds across all categories in deficit
         };
         std::vector<Candidate> candidates;
 
@@ -608,62 +1206,103 @@ namespace Distributor {
             containerIDs.insert(formID);
         }
 
+        // Only containers holding a category in deficit are visited, and only
+        // those categories' holdings are read
         for (auto containerID : containerIDs) {
+            const auto& index = RestockIndex::Get(containerID);
+            auto wanted = index.categories & deficitMask;
+            if (wanted.none()) continue;
+
             auto* containerRef = RE::TESForm::LookupByID<RE::TESObjectREFR>(containerID);
             if (!containerRef) continue;
 
-            auto inv = containerRef->GetInventory();
-            for (auto& [item, data] : inv) {
-                if (!item || data.first <= 0 || IsPhantomItem(item)) continue;
-
-                auto catID = RestockCategory::Classify(item);
-                if (catID.empty()) continue;
-                if (deficit.find(catID) == deficit.end()) continue;
+            int32_t supply = 0;
+            for (const auto& [category, total] : index.totals) {
+                if (wanted.test(category)) supply += std::min(total, deficit[category]);
+            }
+            bool loaded = containerRef->Is3DLoaded();
 
-                float quality = RestockCategory::QualityScore(item, catID);
-                candidates.push_back({item, data.first, containerRef, catID, quality});
+            for (const auto& [category, holdings] : index.holdings) {
+                if (!wanted.test(category)) continue;
+                for (const auto& holding : holdings) {
+                    candidates.push_back({holding.item, holding.count, containerID, category,
+                                          holding.quality, loaded, supply});
+                }
             }
         }
 
-        // Step 4: Sort candidates by quality descending (best first)
+        // Step 4: Best quality first. Among equal quality, pull from as few
+        // containers and as few stacks as possible: loaded containers, then
+        // containers that can cover most of the deficit, then larger stacks.
         std::sort(candidates.begin(), candidates.end(),
             [](const Candidate& a, const Candidate& b) {
-                return a.qualityScore > b.qualityScore;
+                if (a.qualityScore != b.qualityScore) return a.qualityScore > b.qualityScore;
+                if (a.sourceLoaded != b.sourceLoaded) return a.sourceLoaded;
+                if (a.sourceSupply != b.sourceSupply) return a.sourceSupply > b.sourceSupply;
+                if (a.sourceFormID != b.sourceFormID) return a.sourceFormID < b.sourceFormID;
+                return a.count > b.count;
             });
 
         // Step 5: Pull items up to deficit per category
-        struct MoveEntry {
-            RE::TESBoundObject* item;
-            int32_t count;
-            RE::TESObjectREFR* source;
-        };
-        std::vector<MoveEntry> toMove;
+        std::vector<int32_t> planned(categories.size(), 0);
+        std::set<RE::FormID> sources;
+        for (const auto& cand : candidates) {
+            auto& need = deficit[cand.category];
+            if (need <= 0) continue;
+
+            int32_t take = std::min(cand.count, need);
+            plan.moves.push_back({cand.item, take, cand.sourceFormID, player->GetFormID()});
+            planned[cand.category] += take;
+            sources.insert(cand.sourceFormID);
+            need -= take;
+        }
 
-        for (auto& cand : candidates) {
-            auto dit = deficit.find(cand.categoryID);
-            if (dit == deficit.end() || dit->second <= 0) continue;
+        for (size_t i = 0; i < categories.size(); ++i) {
+            if (target[i] <= 0) continue;
+            plan.categories.push_back({static_cast<RestockCategory::CategoryIndex>(i),
+                                       playerCounts[i], planned[i]});
+            plan.totalItems += static_cast<uint32_t>(planned[i]);
+        }
+        plan.sourceCount = static_cast<uint32_t>(sources.size());
+
+        return plan;
+    }
 
-            int32_t take = std::min(cand.count, dit->second);
-            if (take <= 0) continue;
+    RestockResult Restock(const std::string& a_networkName) {
+        RestockResult result;
 
-            toMove.push_back({cand.item, take, cand.sourceRef});
-            dit->second -= take;
+        if (MoveExecutor::IsBusy()) {
+            logger::info("Restock: move job running, ignoring Restock of '{}'", a_networkName);
+            return result;
         }
 
-        // Step 6: Execute moves
-        auto* playerRef = player->As<RE::TESObjectREFR>();
-        for (const auto& entry : toMove) {
-            logger::debug("  Restock: {}x {} from {:08X}",
-                         entry.count, entry.item->GetName(),
-                         entry.source->GetFormID());
+        auto* net = NetworkManager::GetSingleton()->FindNetwork(a_networkName);
+        if (!net) {
+            logger::error("Restock: network '{}' not found", a_networkName);
+            return result;
+        }
 
-            entry.source->RemoveItem(entry.item, entry.count, RE::ITEM_REMOVE_REASON::kStoreInContainer,
-                                     nullptr, playerRef);
-            result.totalItems += entry.count;
+        if (!net->restockConfig.configured) {
+            return result;
         }
 
-        logger::info("Restock: pulled {} items ({} stacks) in network '{}'",
-                     result.totalItems, toMove.size(), a_networkName);
+        // Plan against the player's inventory as it is now, not the cached
+        // snapshot — the config menu preview is the only caller that keeps it.
+        if (auto* player = RE::PlayerCharacter::GetSingleton()) {
+            InventoryCache::Invalidate(player->GetFormID());
+        }
+
+        auto plan = PlanRestock(a_networkName, net->restockConfig);
+        if (plan.moves.empty()) {
+            logger::info("Restock: nothing needed in network '{}'", a_networkName);
+            return result;
+        }
+
+        // Step 6: Execute moves
+        result.totalItems = MoveExecutor::RunNow(plan.moves).itemsMoved;
+
+        logger::info("Restock: pulled {} items ({} stacks from {} containers) in network '{}'",
+                     result.totalItems, plan.moves.size(), plan.sourceCount, a_networkName);
 
         return result;
     }
@@ -683,7 +1322,9 @@ namespace Distributor {
             return result;
         }
 
-        // Timer check: if timer started and not enough time elapsed, skip
+        // Timer check: if timer started and not enough time elapsed, skip.
+        // Otherwise every full interval since the last sale is owed a batch.
+        int32_t intervals = 1;
         const auto& sellState = mgr->GetSellState();
         if (sellState.timerStarted) {
             auto* calendar = RE::Calendar::GetSingleton();
@@ -695,12 +1336,13 @@ namespace Distributor {
                                   elapsed, Settings::fSellIntervalHours);
                     return result;
                 }
+                intervals = OwedIntervals(elapsed, Settings::fSellIntervalHours);
             }
         }
 
         // Iterate sell container inventory
-        auto inv = sellRef->GetInventory();
-        if (inv.empty()) {
+        auto inv = InventoryCache::Get(sellFormID);
+        if (inv->empty()) {
             logger::debug("ProcessSales: sell container is empty");
             return result;
         }
@@ -727,17 +1369,17 @@ namespace Distributor {
         };
         std::vector<SellEntry> toSell;
         int32_t itemsCollected = 0;
+        const int32_t capacity = CatchUpCapacity(Settings::iSellBatchSize, intervals);
 
-        for (auto& [item, data] : inv) {
-            if (!item || data.first <= 0 || IsPhantomItem(item)) continue;
+        for (const auto& [item, count] : *inv) {
             if (item->IsGold()) continue;
 
             int32_t baseValue = item->GetGoldValue();
             float pricePerUnit = baseValue * Settings::fSellPricePercent;
 
-            // Collect up to batch size
-            int32_t available = data.first;
-            int32_t toTake = std::min(available, static_cast<int32_t>(Settings::iSellBatchSize) - itemsCollected);
+            // Collect up to batch size for every owed interval
+            int32_t available = count;
+            int32_t toTake = std::min(available, capacity - itemsCollected);
             if (toTake <= 0) break;
 
             std::string name = item->GetName();
@@ -746,7 +1388,7 @@ namespace Distributor {
             toSell.push_back({item, toTake, pricePerUnit, name});
             itemsCollected += toTake;
 
-            if (itemsCollected >= Settings::iSellBatchSize) break;
+            if (itemsCollected >= capacity) break;
         }
 
         if (toSell.empty()) {
@@ -762,6 +1404,8 @@ namespace Distributor {
             sellRef->RemoveItem(entry.item, entry.count, RE::ITEM_REMOVE_REASON::kStoreInContainer, nullptr, nullptr);
 
             SaleTransaction tx;
+            tx.itemFormID = entry.item->GetFormID();
+            tx.itemType = entry.item->GetFormType();
             tx.itemName = entry.name;
             tx.vendorName = "General Vendor";
             tx.vendorAssortment = "General Assortment";
@@ -779,16 +1423,18 @@ namespace Distributor {
         if (totalGold > 0) {
             sellRef->AddObjectToContainer(goldForm, nullptr, totalGold, nullptr);
         }
+        InventoryCache::Invalidate(sellFormID);
 
         result.itemsSold = static_cast<uint32_t>(itemsCollected);
         result.goldEarned = totalGold;
+        result.intervals = static_cast<uint32_t>(intervals);
 
         // Record in NetworkManager
         mgr->RecordSale(result.itemsSold, result.goldEarned);
         mgr->SetLastSellTime(gameTime + RandomJitter());
 
-        logger::info("ProcessSales: sold {} items for {} gold from sell container {:08X}",
-                     result.itemsSold, result.goldEarned, sellFormID);
+        logger::info("ProcessSales: sold {} items for {} gold from sell container {:08X} ({} interval(s))",
+                     result.itemsSold, result.goldEarned, sellFormID, intervals);
 
         return result;
     }
@@ -822,6 +1468,26 @@ namespace Distributor {
             return result;
         }
 
+        // Collect due vendors with their compiled buy lists
+        struct VendorBuyEntry {
+            RE::TESBoundObject* item;
+            int32_t count;
+            float pricePerUnit;
+            std::string name;
+        };
+        struct DueVendor {
+            const RegisteredVendor* vendor;
+            const CompiledBuyList* buyList;
+            int32_t visits;    // owed visits since lastVisitTime
+            int32_t capacity;  // batch size * owed visits
+            std::vector<VendorBuyEntry> toBuy;
+            int32_t itemsCollected = 0;
+        };
+        std::vector<DueVendor> due;
+
+        // One compiled snapshot for the whole pass — DueVendor::buyList points into it
+        auto buyLists = vendorReg->GetBuyLists();
+
         for (const auto& vendor : vendors) {
             if (!vendor.active) continue;
 
@@ -834,82 +1500,66 @@ namespace Distributor {
             }
 
             // Look up the vendor's buy list from their faction
-            auto* faction = RE::TESForm::LookupByID<RE::TESFaction>(vendor.factionFormID);
-            if (!faction) {
+            auto* buyList = buyLists->Find(vendor.factionFormID);
+            if (!buyList) {
                 logger::warn("ProcessVendorSales: faction {:08X} for {} not found",
                              vendor.factionFormID, vendor.vendorName);
                 continue;
             }
+            int32_t visits = OwedIntervals(elapsed, Settings::fVendorIntervalHours);
+            due.push_back({&vendor, buyList, visits, CatchUpCapacity(Settings::iVendorBatchSize, visits)});
+        }
+        if (due.empty()) return result;
+
+        // One pass over one snapshot: each item is offered to the due vendors in
+        // registration order, each taking what it buys up to its batch size times
+        // its owed visits. Same allocation as visiting vendors one after another.
+        auto inv = InventoryCache::Get(sellRef->GetFormID());
+        if (inv->empty()) {
+            logger::debug("ProcessVendorSales: sell container empty, skipping {} vendors", due.size());
+            return result;
+        }
 
-            auto* buyList = faction->vendorData.vendorSellBuyList;
-            bool inverted = faction->vendorData.vendorValues.notBuySell;
+        size_t vendorsFull = 0;
+        std::vector<uint64_t> itemMask;
 
-            // Scan sell container for items matching this vendor's buy list
-            auto inv = sellRef->GetInventory();
-            if (inv.empty()) {
-                logger::debug("ProcessVendorSales: sell container empty, skipping {}", vendor.vendorName);
-                continue;
-            }
-
-            struct VendorBuyEntry {
-                RE::TESBoundObject* item;
-                int32_t count;
-                float pricePerUnit;
-                std::string name;
-            };
-            std::vector<VendorBuyEntry> toBuy;
-            int32_t itemsCollected = 0;
+        for (const auto& [item, count] : *inv) {
+            if (vendorsFull == due.size()) break;
+            if (item->IsGold()) continue;
 
-            for (auto& [item, data] : inv) {
-                if (!item || data.first <= 0 || IsPhantomItem(item)) continue;
-                if (item->IsGold()) continue;
-
-                // Check if item matches vendor's buy list
-                bool matches = false;
-                if (buyList) {
-                    // BGSListForm contains keywords — check if item has any of them
-                    auto* keyworded = item->As<RE::BGSKeywordForm>();
-                    if (keyworded) {
-                        buyList->ForEachForm([&](RE::TESForm* a_form) {
-                            auto* keyword = a_form->As<RE::BGSKeyword>();
-                            if (keyword && keyworded->HasKeyword(keyword)) {
-                                matches = true;
-                                return RE::BSContainer::ForEachResult::kStop;
-                            }
-                            return RE::BSContainer::ForEachResult::kContinue;
-                        });
-                    }
-                } else {
-                    // No buy list = buys nothing (unless inverted)
-                    matches = false;
-                }
+            buyLists->GetItemKeywordMask(item, itemMask);
+            int32_t available = count;
 
-                // Apply inversion if set
-                if (inverted) matches = !matches;
+            for (auto& dv : due) {
+                if (available <= 0) break;
+                if (dv.itemsCollected >= dv.capacity) continue;
 
-                if (!matches) continue;
+                // Check if item matches vendor's buy list (inversion applied)
+                if (!VendorRegistry::Buys(*dv.buyList, itemMask)) continue;
 
                 int32_t baseValue = item->GetGoldValue();
                 float pricePerUnit = baseValue * Settings::fVendorPricePercent;
-                if (vendor.invested) {
+                if (dv.vendor->invested) {
                     pricePerUnit *= 1.05f;
                 }
 
-                int32_t available = data.first;
-                int32_t toTake = std::min(available,
-                    static_cast<int32_t>(Settings::iVendorBatchSize) - itemsCollected);
-                if (toTake <= 0) break;
+                int32_t toTake = std::min(available, dv.capacity - dv.itemsCollected);
 
                 std::string name = item->GetName();
                 if (name.empty()) name = "Unknown Item";
 
-                toBuy.push_back({item, toTake, pricePerUnit, name});
-                itemsCollected += toTake;
+                dv.toBuy.push_back({item, toTake, pricePerUnit, std::move(name)});
+                dv.itemsCollected += toTake;
+                available -= toTake;
 
-                if (itemsCollected >= Settings::iVendorBatchSize) break;
+                if (dv.itemsCollected >= dv.capacity) ++vendorsFull;
             }
+        }
+
+        for (auto& dv : due) {
+            const auto& vendor = *dv.vendor;
 
-            if (toBuy.empty()) {
+            if (dv.toBuy.empty()) {
                 // Vendor visited but found nothing to buy — still update timer
                 vendorReg->RecordVendorSale(vendor.npcBaseFormID, 0, 0, currentHours);
                 logger::debug("ProcessVendorSales: {} visited but found no matching items",
@@ -919,7 +1569,7 @@ namespace Distributor {
 
             // Execute purchases
             uint32_t vendorGold = 0;
-            for (const auto& entry : toBuy) {
+            for (const auto& entry : dv.toBuy) {
                 int32_t goldEarned = static_cast<int32_t>(entry.pricePerUnit * entry.count);
                 vendorGold += goldEarned;
 
@@ -927,6 +1577,8 @@ namespace Distributor {
                     RE::ITEM_REMOVE_REASON::kStoreInContainer, nullptr, nullptr);
 
                 SaleTransaction tx;
+                tx.itemFormID = entry.item->GetFormID();
+                tx.itemType = entry.item->GetFormType();
                 tx.itemName = entry.name;
                 tx.vendorName = vendor.vendorName;
                 tx.vendorAssortment = vendor.storeName;
@@ -948,15 +1600,17 @@ namespace Distributor {
 
             // Record in vendor registry
             vendorReg->RecordVendorSale(vendor.npcBaseFormID,
-                static_cast<uint32_t>(itemsCollected), vendorGold, currentHours);
+                static_cast<uint32_t>(dv.itemsCollected), vendorGold, currentHours);
 
-            result.totalItemsSold += itemsCollected;
+            result.totalItemsSold += dv.itemsCollected;
             result.totalGoldEarned += vendorGold;
+            result.visits += static_cast<uint32_t>(dv.visits);
             ++result.vendorsVisited;
 
-            logger::info("ProcessVendorSales: {} bought {} items for {} gold",
-                         vendor.vendorName, itemsCollected, vendorGold);
+            logger::info("ProcessVendorSales: {} bought {} items for {} gold ({} visit(s))",
+                         vendor.vendorName, dv.itemsCollected, vendorGold, dv.visits);
         }
+        InventoryCache::Invalidate(sellRef->GetFormID());
 
         if (result.vendorsVisited > 0) {
             logger::info("ProcessVendorSales: {} vendors visited, {} items sold for {} gold total",
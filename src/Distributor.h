@@ -1,5 +1,6 @@
 #pragma once
 
+#include "MoveExecutor.h"
 #include "Network.h"
 #include "NetworkManager.h"
 
@@ -11,12 +12,14 @@ namespace Distributor {
     struct DistributeResult {
         uint32_t totalItems = 0;
         std::vector<std::pair<std::string, uint32_t>> perContainer;  // container name -> count
+        bool cancelled = false;  // async Sort stopped early (player left the cell / game loaded)
     };
 
     // Result of a sales processing cycle
     struct SalesResult {
         uint32_t itemsSold  = 0;
         uint32_t goldEarned = 0;
+        uint32_t intervals  = 0;  // sell intervals covered (>1 when catching up)
         std::vector<SaleTransaction> transactions;
     };
 
@@ -34,11 +37,38 @@ namespace Distributor {
 
     // Gather all items from pipeline containers back to master (Sort phase 1).
     // Returns total items moved. Used by summoned chest before opening master.
+    // Like every move entry point below, returns without moving anything while
+    // a MoveExecutor job is running — callers check IsBusy() to tell the player.
     uint32_t GatherToMaster(const std::string& a_networkName);
 
     // Run distribution for a named network (must be called on game thread).
+    // With Settings::bDeltaSort only misplaced stacks move (source -> target);
+    // otherwise everything is gathered to master and redistributed.
     DistributeResult Distribute(const std::string& a_networkName);
 
+    // Same plan as Distribute(), executed over several frames by MoveExecutor.
+    // a_onComplete runs on the game thread when the job ends (possibly before
+    // this returns, for plans that fit in one frame). Returns false without
+    // calling back if the network is missing or another move job is running.
+    bool DistributeAsync(const std::string& a_networkName,
+                         std::function<void(const DistributeResult&)> a_onComplete,
+                         MoveExecutor::ProgressCallback a_onProgress = nullptr);
+
+    // Progress callback for the async Sorts: a "Sorting... N%" toast at most
+    // once per second, so only Sorts that span frames show one.
+    MoveExecutor::ProgressCallback MakeSortProgressNotifier();
+
+    // Sort All: plan every Link together and run the combined plan as one job.
+    // Links share the cached inventories, routing tables and trait cache; each
+    // is planned with the earlier Links' moves applied, so containers shared
+    // between Links stay consistent. Same Delta/full mode as Distribute().
+    DistributeResult DistributeAll();
+
+    // Sort All over several frames. Returns false without calling back if no
+    // network could be planned or another move job is running.
+    bool DistributeAllAsync(std::function<void(const DistributeResult&)> a_onComplete,
+                            MoveExecutor::ProgressCallback a_onProgress = nullptr);
+
     // Whoosh: drain player inventory into master container based on per-filter set
     // Returns number of items moved. Returns 0 if not configured (caller shows popup).
     uint32_t Whoosh(const std::string& a_networkName);
@@ -59,6 +89,41 @@ namespace Distributor {
         RE::FormID a_masterFormID,
         const std::vector<FilterStage>& a_filters);
 
+    // Snapshot-based prediction for the config menu. The first Predict()
+    // captures master + linked container contents and each item's match
+    // against every filter in the pipeline; later calls (reorder, relink)
+    // only recompute first-match over the cached bits. A container linked
+    // after the snapshot is captured on first use, a filter added after it
+    // is matched against the pool once. Any container change (Sort, Sweep,
+    // Whoosh, gather) discards the snapshot automatically.
+    class PredictionSession {
+    public:
+        explicit PredictionSession(RE::FormID a_masterFormID) : m_masterFormID(a_masterFormID) {}
+
+        // Same contract as PredictDistribution().
+        PredictionResult Predict(const std::vector<FilterStage>& a_filters);
+
+        // Discard all snapshots (next Predict() re-reads inventories).
+        void Reset();
+
+        RE::FormID GetMasterFormID() const { return m_masterFormID; }
+
+    private:
+        struct ContainerSnapshot {
+            std::vector<std::pair<uint32_t, int32_t>> items;  // item index, count
+        };
+
+        const ContainerSnapshot& GetContainer(RE::FormID a_formID);
+        const std::vector<uint8_t>& GetMatchColumn(const std::string& a_filterID);
+
+        RE::FormID m_masterFormID = 0;
+        uint32_t m_inventoryEpoch = 0;
+        std::vector<RE::TESBoundObject*> m_items;
+        std::unordered_map<RE::TESBoundObject*, uint32_t> m_itemIndex;
+        std::unordered_map<RE::FormID, ContainerSnapshot> m_containers;
+        std::unordered_map<std::string, std::vector<uint8_t>> m_matchColumns;  // filterID -> per-item match
+    };
+
     // --- Pipeline types ---
 
     struct PoolItem {
@@ -93,6 +158,17 @@ namespace Distributor {
         const std::vector<PoolItem>& a_pool,
         bool a_resolveRefs);
 
+    // Route items just deposited into a network's master (auto-route). Only the
+    // given stacks are considered, each through its memoized routing decision;
+    // Keep / unmatched items stay. Counts are clamped to what master still holds.
+    DistributeResult RouteDeposits(const std::string& a_networkName, const std::vector<PoolItem>& a_deposits);
+
+    // Drop all memoized routing decisions (per-master first-match tables used by
+    // RunPipeline) and Whoosh filter-match bits. Both self-invalidate on pipeline
+    // or Whoosh selection edits and filter reloads; call this when a save is
+    // loaded since dynamic forms and FormLists may differ.
+    void ClearRouteTables();
+
     // Restock: pull items from Link containers to player up to configured quantities.
     // Best-first quality sorting. Returns total items moved.
     struct RestockResult {
@@ -100,8 +176,28 @@ namespace Distributor {
     };
     RestockResult Restock(const std::string& a_networkName);
 
+    // Dry-run Restock: the moves Restock() would make for a_config (which need
+    // not be the network's saved config — the config menu previews edits).
+    // Best quality first; among equal quality, loaded containers, containers
+    // covering more of the deficit, and larger stacks are preferred, so the
+    // same totals come from as few containers and moves as possible.
+    struct RestockPlan {
+        struct CategoryPlan {
+            RestockCategory::CategoryIndex category;
+            int32_t have = 0;     // already in player inventory
+            int32_t planned = 0;  // would be pulled
+        };
+        std::vector<MoveExecutor::Move> moves;      // source container -> player
+        std::vector<CategoryPlan> categories;       // every enabled category, taxonomy order
+        uint32_t totalItems = 0;
+        uint32_t sourceCount = 0;                   // distinct containers pulled from
+    };
+    RestockPlan PlanRestock(const std::string& a_networkName, const RestockCategory::RestockConfig& a_config);
+
     // Process sales: sell items from sell container, deposit gold.
     // Respects timer interval, batch size, and price settings from INI.
+    // Every interval elapsed since the last sale is owed one batch; owed
+    // batches (up to iMaxCatchUpIntervals) are sold together in one pass.
     SalesResult ProcessSales();
 
     // Vendor-specific sales result (one per vendor that visited)
@@ -110,9 +206,11 @@ namespace Distributor {
         uint32_t totalGoldEarned = 0;
         std::vector<SaleTransaction> transactions;
         int vendorsVisited = 0;
+        uint32_t visits    = 0;  // owed visits covered, summed over vendors
     };
 
     // Process registered vendor sales: each vendor buys items matching their
     // faction buy list from the sell container on independent timers.
+    // Vendors catch up on missed visits the same way ProcessSales does.
     VendorSalesResult ProcessVendorSales();
 }
@@ -2,6 +2,9 @@
 #include "MenuLayout.h"
 #include "MouseGlow.h"
 #include "ScaleformUtil.h"
+#include "TranslationService.h"
+
+#include <Windows.h>
 
 // --- Static member ---
 Dropdown* Dropdown::s_openInstance = nullptr;
@@ -37,10 +40,42 @@ static constexpr int ALPHA_ROW_SEL       = 85;
 static constexpr int ALPHA_ROW_NORM      = 60;
 static constexpr int ALPHA_ROW_HOV       = 75;
 
+// --- Search text helpers ---
+//
+// Keys are compared as lowercased UTF-16 so any of the translated scripts
+// (accented Latin, Cyrillic, CJK) match case-insensitively via the OS tables.
+
+static std::wstring ToSearchKey(const std::string& a_utf8) {
+    if (a_utf8.empty()) return {};
+    int len = MultiByteToWideChar(CP_UTF8, 0, a_utf8.data(), static_cast<int>(a_utf8.size()), nullptr, 0);
+    if (len <= 0) return {};
+    std::wstring wide(len, L'\0');
+    MultiByteToWideChar(CP_UTF8, 0, a_utf8.data(), static_cast<int>(a_utf8.size()), wide.data(), len);
+    CharLowerBuffW(wide.data(), static_cast<DWORD>(wide.size()));
+    return wide;
+}
+
+static std::string ToUtf8(const std::wstring& a_wide) {
+    if (a_wide.empty()) return {};
+    int len = WideCharToMultiByte(CP_UTF8, 0, a_wide.data(), static_cast<int>(a_wide.size()),
+                                  nullptr, 0, nullptr, nullptr);
+    if (len <= 0) return {};
+    std::string utf8(len, '\0');
+    WideCharToMultiByte(CP_UTF8, 0, a_wide.data(), static_cast<int>(a_wide.size()),
+                        utf8.data(), len, nullptr, nullptr);
+    return utf8;
+}
+
+// Sub-group header rows (injected by BuildPickerList)
+static bool IsHeader(const Dropdown::Entry& a_entry) {
+    return a_entry.id.empty() && !a_entry.subGroup.empty();
+}
+
 // --- Lifecycle ---
 
 Dropdown::~Dropdown() {
     if (s_openInstance == this) s_openInstance = nullptr;
+    ReleaseTextInput();
 }
 
 Dropdown::Dropdown(Dropdown&& a_other) noexcept
@@ -50,6 +85,12 @@ Dropdown::Dropdown(Dropdown&& a_other) noexcept
     , m_closedColorOverride(a_other.m_closedColorOverride)
     , m_entries(std::move(a_other.m_entries))
     , m_config(std::move(a_other.m_config))
+    , m_view(std::move(a_other.m_view))
+    , m_searchKeys(std::move(a_other.m_searchKeys))
+    , m_headerOf(std::move(a_other.m_headerOf))
+    , m_matches(std::move(a_other.m_matches))
+    , m_query(std::move(a_other.m_query))
+    , m_ownsTextInput(a_other.m_ownsTextInput)
     , m_open(a_other.m_open)
     , m_callback(std::move(a_other.m_callback))
     , m_cursorIndex(a_other.m_cursorIndex)
@@ -74,6 +115,7 @@ Dropdown::Dropdown(Dropdown&& a_other) noexcept
     if (s_openInstance == &a_other) s_openInstance = this;
     a_other.m_open = false;
     a_other.m_movie = nullptr;
+    a_other.m_ownsTextInput = false;
 }
 
 Dropdown& Dropdown::operator=(Dropdown&& a_other) noexcept {
@@ -81,6 +123,7 @@ Dropdown& Dropdown::operator=(Dropdown&& a_other) noexcept {
 
     // If we were the open instance, clear it before overwrite
     if (s_openInstance == this) s_openInstance = nullptr;
+    ReleaseTextInput();
 
     m_selectedId = std::move(a_other.m_selectedId);
     m_selectedLabel = std::move(a_other.m_selectedLabel);
@@ -88,6 +131,12 @@ Dropdown& Dropdown::operator=(Dropdown&& a_other) noexcept {
     m_closedColorOverride = a_other.m_closedColorOverride;
     m_entries = std::move(a_other.m_entries);
     m_config = std::move(a_other.m_config);
+    m_view = std::move(a_other.m_view);
+    m_searchKeys = std::move(a_other.m_searchKeys);
+    m_headerOf = std::move(a_other.m_headerOf);
+    m_matches = std::move(a_other.m_matches);
+    m_query = std::move(a_other.m_query);
+    m_ownsTextInput = a_other.m_ownsTextInput;
     m_open = a_other.m_open;
     m_callback = std::move(a_other.m_callback);
     m_cursorIndex = a_other.m_cursorIndex;
@@ -111,6 +160,7 @@ Dropdown& Dropdown::operator=(Dropdown&& a_other) noexcept {
     if (s_openInstance == &a_other) s_openInstance = this;
     a_other.m_open = false;
     a_other.m_movie = nullptr;
+    a_other.m_ownsTextInput = false;
 
     return *this;
 }
@@ -325,6 +375,19 @@ void Dropdown::Open(RE::GFxMovieView* a_movie, double a_anchorX, double a_anchor
     s_openInstance = this;
 
     int entryCount = static_cast<int>(m_entries.size());
+    m_view.resize(entryCount);
+    for (int i = 0; i < entryCount; ++i) m_view[i] = i;
+
+    m_query.clear();
+    m_matches.clear();
+    if (m_config.searchable) {
+        BuildSearchIndex();
+        AcquireTextInput();
+    } else {
+        m_searchKeys.clear();
+        m_headerOf.clear();
+    }
+
     m_visibleCount = std::min(entryCount, m_config.maxVisible);
 
     // Pre-select
@@ -361,7 +424,7 @@ void Dropdown::Prev() {
 
 void Dropdown::Next() {
     if (!m_open) return;
-    int count = static_cast<int>(m_entries.size());
+    int count = ViewCount();
     if (m_cursorIndex >= count - 1) return;
     m_cursorIndex++;
     if (m_cursorIndex >= m_scrollOffset + m_visibleCount) {
@@ -372,17 +435,17 @@ void Dropdown::Next() {
 
 void Dropdown::Confirm() {
     if (!m_open) return;
-    int entryCount = static_cast<int>(m_entries.size());
-    if (m_cursorIndex < 0 || m_cursorIndex >= entryCount) return;
-    if (!m_entries[m_cursorIndex].enabled) return;
+    if (m_cursorIndex < 0 || m_cursorIndex >= ViewCount()) return;
+    if (!ViewEntry(m_cursorIndex).enabled) return;
 
     m_open = false;
     if (s_openInstance == this) s_openInstance = nullptr;
 
-    auto id = m_entries[m_cursorIndex].id;
-    auto label = m_entries[m_cursorIndex].label;
-    auto idx = m_cursorIndex;
+    auto id = ViewEntry(m_cursorIndex).id;
+    auto label = ViewEntry(m_cursorIndex).label;
+    auto idx = m_view[m_cursorIndex];
     DestroyPopupVisuals();
+    ReleaseTextInput();
 
     m_selectedId = id;
     m_selectedLabel = label;
@@ -391,6 +454,7 @@ void Dropdown::Confirm() {
     m_callback = nullptr;
     m_movie = nullptr;
     m_entries.clear();
+    m_view.clear();
 
     if (cb) cb(true, idx, id);
 }
@@ -401,11 +465,13 @@ void Dropdown::Cancel() {
     m_open = false;
 
     DestroyPopupVisuals();
+    ReleaseTextInput();
 
     auto cb = std::move(m_callback);
     m_callback = nullptr;
     m_movie = nullptr;
     m_entries.clear();
+    m_view.clear();
 
     if (cb) cb(false, -1, "");
 }
@@ -416,7 +482,7 @@ void Dropdown::OnMouseClick(float a_mx, float a_my) {
     if (!m_open) return;
 
     // Check row hits
-    int entryCount = static_cast<int>(m_entries.size());
+    int entryCount = ViewCount();
     int visibleRows = std::min(entryCount - m_scrollOffset, m_visibleCount);
     double rowW = m_popupW - PAD * 2 - 8.0;
     double rowX = m_popupX + PAD;
@@ -426,7 +492,7 @@ void Dropdown::OnMouseClick(float a_mx, float a_my) {
         if (a_mx >= rowX && a_mx <= rowX + rowW &&
             a_my >= rowY && a_my <= rowY + m_config.rowHeight) {
             int dataIdx = m_scrollOffset + i;
-            if (dataIdx >= 0 && dataIdx < entryCount && m_entries[dataIdx].enabled) {
+            if (dataIdx >= 0 && dataIdx < entryCount && ViewEntry(dataIdx).enabled) {
                 m_cursorIndex = dataIdx;
                 Confirm();
             }
@@ -453,7 +519,7 @@ void Dropdown::UpdateHover(float a_mx, float a_my) {
     int oldHover = m_hoverIndex;
     m_hoverIndex = -1;
 
-    int entryCount = static_cast<int>(m_entries.size());
+    int entryCount = ViewCount();
     int visibleRows = std::min(entryCount - m_scrollOffset, m_visibleCount);
     double rowW = m_popupW - PAD * 2 - 8.0;
     double rowX = m_popupX + PAD;
@@ -484,24 +550,157 @@ void Dropdown::Destroy() {
         m_open = false;
         DestroyPopupVisuals();
     }
+    ReleaseTextInput();
     m_callback = nullptr;
     m_movie = nullptr;
     m_entries.clear();
+    m_view.clear();
 }
 
 // --- Internal helpers ---
 
 int Dropdown::FindNextEnabled(int a_from, int a_dir) const {
-    int count = static_cast<int>(m_entries.size());
+    int count = ViewCount();
     if (count == 0) return -1;
     int idx = a_from + a_dir;
     while (idx >= 0 && idx < count) {
-        if (m_entries[idx].enabled) return idx;
+        if (ViewEntry(idx).enabled) return idx;
         idx += a_dir;
     }
     return -1;
 }
 
+bool Dropdown::IsSearchable() const { return m_open && m_config.searchable; }
+
+void Dropdown::AppendSearchChar(uint32_t a_char) {
+    if (!IsSearchable()) return;
+    if (a_char < 32 || a_char == 127 || a_char > 0xFFFF) return;
+
+    m_query.push_back(static_cast<wchar_t>(a_char));
+    ApplySearch(true);
+}
+
+void Dropdown::EraseSearchChar() {
+    if (!IsSearchable() || m_query.empty()) return;
+
+    m_query.pop_back();
+    // Don't leave half a surrogate pair behind
+    if (!m_query.empty() && IS_HIGH_SURROGATE(m_query.back())) m_query.pop_back();
+    ApplySearch(false);
+}
+
+void Dropdown::BuildSearchIndex() {
+    int count = static_cast<int>(m_entries.size());
+    m_searchKeys.assign(count, {});
+    m_headerOf.assign(count, -1);
+
+    int header = -1;
+    for (int i = 0; i < count; ++i) {
+        const auto& entry = m_entries[i];
+        if (IsHeader(entry)) {
+            header = i;
+            continue;
+        }
+        if (header >= 0 && (entry.subGroup != m_entries[header].subGroup ||
+                            entry.group != m_entries[header].group)) {
+            header = -1;
+        }
+        m_headerOf[i] = header;
+
+        // Unit separator keeps a query from matching across label and sublabel
+        m_searchKeys[i] = ToSearchKey(entry.label);
+        if (!entry.sublabel.empty()) {
+            m_searchKeys[i] += L'\x1F';
+            m_searchKeys[i] += ToSearchKey(entry.sublabel);
+        }
+    }
+}
+
+void Dropdown::ApplySearch(bool a_narrowing) {
+    int count = static_cast<int>(m_entries.size());
+    auto query = m_query;
+    CharLowerBuffW(query.data(), static_cast<DWORD>(query.size()));
+
+    if (query.empty()) {
+        m_matches.clear();
+        m_view.resize(count);
+        for (int i = 0; i < count; ++i) m_view[i] = i;
+    } else {
+        // Appending a character can only shrink the result — rescan the
+        // previous matches instead of every entry
+        std::vector<int> matches;
+        auto test = [&](int a_index) {
+            if (m_searchKeys[a_index].find(query) != std::wstring::npos) matches.push_back(a_index);
+        };
+        if (a_narrowing && m_query.size() > 1) {
+            for (int i : m_matches) test(i);
+        } else {
+            for (int i = 0; i < count; ++i) {
+                if (!IsHeader(m_entries[i])) test(i);
+            }
+        }
+        m_matches = std::move(matches);
+
+        // Keep each surviving row's section header above it
+        m_view.clear();
+        int lastHeader = -1;
+        for (int i : m_matches) {
+            int header = m_headerOf[i];
+            if (header >= 0 && header != lastHeader) m_view.push_back(header);
+            lastHeader = header;
+            m_view.push_back(i);
+        }
+    }
+
+    // Land on the first label that starts with the query, else the first selectable row
+    m_cursorIndex = -1;
+    if (!query.empty()) {
+        for (int pos = 0; pos < ViewCount(); ++pos) {
+            if (ViewEntry(pos).enabled && m_searchKeys[m_view[pos]].starts_with(query)) {
+                m_cursorIndex = pos;
+                break;
+            }
+        }
+    }
+    if (m_cursorIndex < 0) m_cursorIndex = FindNextEnabled(-1, 1);
+    if (m_cursorIndex < 0) m_cursorIndex = 0;
+
+    m_scrollOffset = std::max(0, m_cursorIndex - m_visibleCount + 1);
+    m_hoverIndex = -1;
+
+    UpdateTitle();
+    PopulateRows();
+}
+
+void Dropdown::UpdateTitle() {
+    if (!m_movie) return;
+
+    std::string text = m_query.empty() ? m_config.title : TF("$SLID_DdSearch", ToUtf8(m_query));
+    RE::GFxValue textVal;
+    textVal.SetString(text.c_str());
+    m_movie->SetVariable("_root._ddTitle.text", textVal);
+}
+
+void Dropdown::AcquireTextInput() {
+    // Same ownership rule as TagInputMenu: textEntryCount == -1 is "locked on",
+    // where AllowTextInput(false) would still decrement — only touch it if we can
+    // increment, and decrement exactly once.
+    if (m_ownsTextInput) return;
+    auto* controlMap = RE::ControlMap::GetSingleton();
+    if (controlMap && controlMap->textEntryCount != -1) {
+        controlMap->AllowTextInput(true);
+        m_ownsTextInput = true;
+    }
+}
+
+void Dropdown::ReleaseTextInput() {
+    if (!m_ownsTextInput) return;
+    if (auto* controlMap = RE::ControlMap::GetSingleton()) {
+        controlMap->AllowTextInput(false);
+    }
+    m_ownsTextInput = false;
+}
+
 void Dropdown::DrawPopup() {
     if (!m_movie) {
         logger::error("DrawPopup: m_movie is null, aborting");
@@ -519,7 +718,8 @@ void Dropdown::DrawPopup() {
     int visibleRows = std::min(entryCount, m_config.maxVisible);
     m_visibleCount = visibleRows;
 
-    bool hasTitle = !m_config.title.empty();
+    // Searchable popups always get the title row — it shows the query
+    bool hasTitle = !m_config.title.empty() || m_config.searchable;
     double titleBlock = hasTitle ? (TITLE_H + SEP_H + 4.0) : 0.0;
     double contentH = visibleRows * m_config.rowHeight;
     double neededH = PAD + titleBlock + contentH + PAD;
@@ -657,7 +857,7 @@ void Dropdown::DrawPopup() {
 void Dropdown::PopulateRows() {
     if (!m_movie) return;
 
-    int entryCount = static_cast<int>(m_entries.size());
+    int entryCount = ViewCount();
     int visibleRows = std::min(entryCount - m_scrollOffset, m_visibleCount);
 
     for (int i = 0; i < MAX_ROW_SLOTS; i++) {
@@ -669,10 +869,8 @@ void Dropdown::PopulateRows() {
             vis.SetBoolean(true);
             m_rowClips[i].SetMember("_visible", vis);
 
-            auto& entry = m_entries[dataIdx];
-
-            // Detect sub-group header entries (injected by BuildPickerList)
-            bool isHeader = (entry.id.empty() && !entry.subGroup.empty());
+            auto& entry = ViewEntry(dataIdx);
+            bool isHeader = IsHeader(entry);
 
             std::string rowName = "_ddRow" + std::to_string(i);
             std::string textPath = "_root." + rowName + "._text";
@@ -748,7 +946,7 @@ void Dropdown::PopulateRows() {
                 if (!sepClip.IsUndefined()) {
                     sepClip.Invoke("clear", nullptr, nullptr, 0);
                     int prevIdx = dataIdx - 1;
-                    if (prevIdx >= 0 && m_entries[prevIdx].group != entry.group) {
+                    if (prevIdx >= 0 && ViewEntry(prevIdx).group != entry.group) {
                         double lineW = m_popupW - PAD * 2 - 8.0;
                         RE::GFxValue styleArgs[3];
                         styleArgs[0].SetNumber(1.0);
@@ -804,7 +1002,7 @@ void Dropdown::DrawRowBackground(int a_visIndex, uint32_t a_color, int a_alpha)
 
 void Dropdown::UpdateScrollbar() {
     if (m_scrollThumbClip.IsUndefined()) return;
-    int entryCount = static_cast<int>(m_entries.size());
+    int entryCount = ViewCount();
     if (entryCount <= m_visibleCount) {
         RE::GFxValue vis;
         vis.SetBoolean(false);
@@ -1,4 +1,6 @@
 #include "Feedback.h"
+#include "MoveExecutor.h"
+#include "TranslationService.h"
 
 namespace Feedback {
 
@@ -85,4 +87,10 @@ namespace Feedback {
     void OnError() {
         ShakeController("Error", 0.4f, 0.1f, 0.08f);
     }
+
+    bool NotifyIfMoveBusy() {
+        if (!MoveExecutor::IsBusy()) return false;
+        RE::DebugNotification(T("$SLID_NotifySortBusy").c_str());
+        return true;
+    }
 }
@@ -13,4 +13,8 @@ namespace Feedback {
     void OnSetSellContainer(RE::TESObjectREFR* a_container);
     void OnClearSellContainer(RE::TESObjectREFR* a_container);
     void OnError();
+
+    // True while a time-sliced Sort is still moving items, after telling the
+    // player so. Entry points that move items return early on true.
+    bool NotifyIfMoveBusy();
 }
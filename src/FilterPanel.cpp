@@ -7,6 +7,7 @@
 #include "FilterRegistry.h"
 #include "FilterRow.h"
 #include "HoldRemove.h"
+#include "InventoryCache.h"
 #include "NetworkManager.h"
 #include "ScaleformUtil.h"
 #include "TranslationService.h"
@@ -1541,12 +1542,13 @@ namespace FilterPanel {
             if (containerID == 0 || containerID == masterFormID) return;
             auto* ref = RE::TESForm::LookupByID<RE::TESObjectREFR>(containerID);
             if (!ref) return;
-            auto inv = ref->GetInventory();
-            for (auto& [item, data] : inv) {
-                if (!item || data.first <= 0 || IsPhantomItem(item)) continue;
-                ref->RemoveItem(item, data.first, RE::ITEM_REMOVE_REASON::kStoreInContainer, nullptr, masterRef);
-                totalMoved += data.first;
+            auto inv = InventoryCache::Get(containerID);
+            for (const auto& [item, count] : *inv) {
+                ref->RemoveItem(item, count, RE::ITEM_REMOVE_REASON::kStoreInContainer, nullptr, masterRef);
+                totalMoved += count;
             }
+            InventoryCache::Invalidate(containerID);
+            InventoryCache::Invalidate(masterFormID);
         };
 
         gatherFrom(row.GetData().containerFormID);
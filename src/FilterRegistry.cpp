@@ -1,4 +1,5 @@
 #include "FilterRegistry.h"
+#include "TraitCache.h"
 #include "TraitEvaluator.h"
 #include "Settings.h"
 
@@ -97,40 +98,18 @@ namespace {
             if (!a_item) return false;
 
             // FormType gate — if specified, item must match at least one
-            if (!m_formTypes.empty()) {
-                auto ft = a_item->GetFormType();
-                bool found = false;
-                for (auto t : m_formTypes) {
-                    if (ft == t) { found = true; break; }
-                }
-                if (!found) return false;
-            }
-
-            // RequireTrait — all must pass
-            for (const auto& trait : m_requireTraits) {
-                if (!TraitEvaluator::Evaluate(trait, a_item)) return false;
-            }
+            if (!PassesFormTypeGate(a_item)) return false;
 
-            // ExcludeTrait — none must pass
-            for (const auto& trait : m_excludeTraits) {
-                if (TraitEvaluator::Evaluate(trait, a_item)) return false;
-            }
-
-            // RequireAnyTrait — at least one must pass (if non-empty)
-            if (!m_requireAnyTraits.empty()) {
-                bool anyPassed = false;
-                for (const auto& trait : m_requireAnyTraits) {
-                    if (TraitEvaluator::Evaluate(trait, a_item)) {
-                        anyPassed = true;
-                        break;
-                    }
-                }
-                if (!anyPassed) return false;
-            }
+            // Require/Exclude/RequireAny — served from the shared per-item trait memo
+            return TraitCache::Matches(m_program, a_item);
+        }
 
-            return true;
+        bool DependsOnPlayerState(RE::TESBoundObject* a_item) const override {
+            return m_hasVolatileTraits && a_item && PassesFormTypeGate(a_item);
         }
 
+        const std::vector<RE::FormType>& GetFormTypes() const override { return m_formTypes; }
+
         RE::FormID Route(RE::TESBoundObject* a_item) const override {
             // Check children first
             auto* reg = FilterRegistry::GetSingleton();
@@ -158,7 +137,22 @@ namespace {
             for (const auto& t : m_requireAnyTraits) out.insert(t);
         }
 
+        // Translate trait strings into interned masks. Call after TraitCache::Build().
+        void CompileProgram() {
+            m_program = TraitCache::Compile(m_requireTraits, m_excludeTraits, m_requireAnyTraits);
+            m_hasVolatileTraits = TraitCache::IsVolatile(m_program);
+        }
+
     private:
+        bool PassesFormTypeGate(RE::TESBoundObject* a_item) const {
+            if (m_formTypes.empty()) return true;
+            auto ft = a_item->GetFormType();
+            for (auto t : m_formTypes) {
+                if (ft == t) return true;
+            }
+            return false;
+        }
+
         std::string m_id;
         std::string m_displayName;
         std::string m_description;
@@ -169,6 +163,8 @@ namespace {
         std::vector<std::string> m_requireTraits;
         std::vector<std::string> m_excludeTraits;
         std::vector<std::string> m_requireAnyTraits;
+        TraitCache::Program m_program;
+        bool m_hasVolatileTraits = false;
         bool m_defaultExclude = false;
     };
 
@@ -310,11 +306,14 @@ namespace {
         std::string_view GetDisplayName() const override { return "Catch-All"; }
         std::string_view GetDescription() const override { return "Catches all unclaimed items"; }
         bool Matches([[maybe_unused]] RE::TESBoundObject* a_item) const override { return true; }
+        bool DependsOnPlayerState([[maybe_unused]] RE::TESBoundObject* a_item) const override { return false; }
+        const std::vector<RE::FormType>& GetFormTypes() const override { return s_anyType; }
         const IFilter* GetParent() const override { return nullptr; }
         void BindContainer(RE::FormID a_containerFormID) const override { m_containerFormID = a_containerFormID; }
         RE::FormID GetContainer() const override { return m_containerFormID; }
         RE::FormID Route([[maybe_unused]] RE::TESBoundObject* a_item) const override { return m_containerFormID; }
     private:
+        static inline const std::vector<RE::FormType> s_anyType;
         mutable RE::FormID m_containerFormID = 0;
     };
 
@@ -406,6 +405,13 @@ void FilterRegistry::Init() {
         static_cast<INIFilter*>(filterIt->second.get())->SetParent(parentIt->second.get());
     }
 
+    // Third pass: intern every trait string once, then compile each filter's
+    // trait lists to masks over the shared per-item trait memo
+    TraitCache::Build(GetAllTraitStrings());
+    for (const auto& id : m_order) {
+        static_cast<INIFilter*>(m_filters[id].get())->CompileProgram();
+    }
+
     // Build family index
     for (const auto& id : m_order) {
         auto* filter = GetFilter(id);
@@ -425,6 +431,15 @@ void FilterRegistry::Init() {
     // Register synthetic catch-all filter (not in m_order, not in family hierarchy)
     m_filters[kCatchAllFilterID] = std::make_unique<CatchAllFilter>();
 
+    // Dense index: registration order, catch-all last
+    for (const auto& id : m_order) {
+        if (m_indices.contains(id)) continue;
+        m_indices.emplace(id, static_cast<FilterIndex>(m_byIndex.size()));
+        m_byIndex.push_back(m_filters[id].get());
+    }
+    m_indices.emplace(kCatchAllFilterID, static_cast<FilterIndex>(m_byIndex.size()));
+    m_byIndex.push_back(m_filters[kCatchAllFilterID].get());
+
     // Log summary
     logger::info("FilterRegistry: initialized {} filters ({} roots, {} families with children)",
         m_filters.size(), m_familyRoots.size(), m_children.size());
@@ -440,6 +455,8 @@ void FilterRegistry::Init() {
             }());
     }
 
+    ++m_generation;
+
     // Record load timestamp and file count for change detection
     m_lastLoadTime = std::filesystem::file_time_type::clock::now();
     m_lastFileCount = 0;
@@ -460,6 +477,11 @@ const IFilter* FilterRegistry::GetFilter(const std::string& a_id) const {
     return nullptr;
 }
 
+FilterRegistry::FilterIndex FilterRegistry::GetFilterIndex(const std::string& a_id) const {
+    auto it = m_indices.find(a_id);
+    return it != m_indices.end() ? it->second : kInvalidIndex;
+}
+
 const std::vector<std::string>& FilterRegistry::GetFilterOrder() const {
     return m_order;
 }
@@ -506,6 +528,8 @@ void FilterRegistry::Reload() {
     logger::info("FilterRegistry: reloading filter definitions...");
     m_filters.clear();
     m_order.clear();
+    m_byIndex.clear();
+    m_indices.clear();
     m_familyRoots.clear();
     m_children.clear();
     m_defaultExcluded.clear();
@@ -84,7 +84,8 @@ namespace {
     std::vector<Dropdown::Entry> BuildContainerEntries() {
         auto pickerEntries = ContainerRegistry::GetSingleton()->BuildPickerList(ConfigState::GetMasterFormID());
         std::vector<Dropdown::Entry> entries;
-        for (const auto& pe : pickerEntries) {
+        entries.reserve(pickerEntries->size());
+        for (const auto& pe : *pickerEntries) {
             Dropdown::Entry e;
             e.id = std::to_string(pe.formID);
             e.label = pe.name;
@@ -176,6 +177,7 @@ void FilterRow::OpenContainerDropdown(const DropdownContext& a_ctx, int a_childI
     cfg.width = 400.0;
     cfg.title = T("$SLID_SelectContainer");
     cfg.preSelect = preSelect;
+    cfg.searchable = true;
 
     // Capture by value — FilterRow* is stable (owned by s_filterRows which doesn't relocate during dropdown)
     auto* self = this;
@@ -0,0 +1,100 @@
+#include "InventoryCache.h"
+
+#include <mutex>
+#include <unordered_map>
+
+namespace InventoryCache {
+
+    namespace {
+        struct CachedInventory {
+            std::shared_ptr<const Snapshot> snapshot;
+            int32_t total = 0;
+        };
+
+        // Reads come from the game thread and Papyrus natives
+        std::mutex s_lock;
+        std::unordered_map<RE::FormID, CachedInventory> s_cache;
+        std::atomic<uint32_t> s_epoch{0};
+
+        // Caller must hold s_lock
+        const CachedInventory& GetUnsafe(RE::FormID a_formID) {
+            auto it = s_cache.find(a_formID);
+            if (it != s_cache.end()) return it->second;
+
+            auto snapshot = std::make_shared<Snapshot>();
+            int32_t total = 0;
+            if (auto* ref = RE::TESForm::LookupByID<RE::TESObjectREFR>(a_formID)) {
+                auto inv = ref->GetInventory();
+                snapshot->reserve(inv.size());
+                for (auto& [item, data] : inv) {
+                    if (!item || data.first <= 0 || IsPhantomItem(item)) continue;
+                    snapshot->push_back({item, data.first});
+                    total += data.first;
+                }
+            }
+            return s_cache[a_formID] = CachedInventory{std::move(snapshot), total};
+        }
+
+        class ContainerChangedListener : public RE::BSTEventSink<RE::TESContainerChangedEvent> {
+        public:
+            static ContainerChangedListener* GetSingleton() {
+                static ContainerChangedListener singleton;
+                return &singleton;
+            }
+
+            RE::BSEventNotifyControl ProcessEvent(
+                const RE::TESContainerChangedEvent* a_event,
+                RE::BSTEventSource<RE::TESContainerChangedEvent>*) override {
+                if (!a_event) return RE::BSEventNotifyControl::kContinue;
+
+                {
+                    std::lock_guard lock(s_lock);
+                    if (a_event->oldContainer != 0) s_cache.erase(a_event->oldContainer);
+                    if (a_event->newContainer != 0) s_cache.erase(a_event->newContainer);
+                }
+                s_epoch.fetch_add(1, std::memory_order_relaxed);
+                return RE::BSEventNotifyControl::kContinue;
+            }
+
+        private:
+            ContainerChangedListener() = default;
+        };
+    }
+
+    std::shared_ptr<const Snapshot> Get(RE::FormID a_formID) {
+        std::lock_guard lock(s_lock);
+        return GetUnsafe(a_formID).snapshot;
+    }
+
+    int32_t CountItems(RE::FormID a_formID) {
+        std::lock_guard lock(s_lock);
+        return GetUnsafe(a_formID).total;
+    }
+
+    void Invalidate(RE::FormID a_formID) {
+        {
+            std::lock_guard lock(s_lock);
+            s_cache.erase(a_formID);
+        }
+        s_epoch.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void Clear() {
+        {
+            std::lock_guard lock(s_lock);
+            s_cache.clear();
+        }
+        s_epoch.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    uint32_t GetEpoch() {
+        return s_epoch.load(std::memory_order_relaxed);
+    }
+
+    void RegisterEventSink() {
+        auto* holder = RE::ScriptEventSourceHolder::GetSingleton();
+        if (!holder) return;
+        holder->AddEventSink<RE::TESContainerChangedEvent>(ContainerChangedListener::GetSingleton());
+        logger::info("InventoryCache: registered container-change listener");
+    }
+}
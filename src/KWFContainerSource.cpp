@@ -1,5 +1,7 @@
 #include "ContainerRegistry.h"
 
+#include <unordered_map>
+
 namespace {
     constexpr uint32_t COLOR_FOLLOWER = 0xFFAA66;  // Warm orange (same as NFF — shared group)
     constexpr uint32_t COLOR_DISABLED = 0x555555;
@@ -41,6 +43,12 @@ class KWFContainerSource : public IContainerSource {
     };
 
     std::vector<ResolvedMapping> mappings_;
+    std::unordered_map<RE::FormID, size_t> mappingByContainer_;  // container FormID -> mappings_ index
+
+    const ResolvedMapping* FindMapping(RE::FormID a_formID) const {
+        auto it = mappingByContainer_.find(a_formID);
+        return it != mappingByContainer_.end() ? &mappings_[it->second] : nullptr;
+    }
 
 public:
     KWFContainerSource() {
@@ -59,6 +67,7 @@ public:
         for (const auto& m : KWF_MAPPINGS) {
             auto* ref = dh->LookupForm<RE::TESObjectREFR>(m.containerLocal, KWF_ESP);
             if (ref) {
+                mappingByContainer_.emplace(ref->GetFormID(), mappings_.size());
                 mappings_.push_back({m.followerAlias, ref->GetFormID(), m.followerName});
                 logger::debug("KWFContainerSource: {} container {:08X}", m.followerName, ref->GetFormID());
             } else {
@@ -72,17 +81,13 @@ public:
     int GetPriority() const override { return 6; }
 
     bool OwnsContainer(RE::FormID a_formID) const override {
-        if (a_formID == 0 || mappings_.empty()) return false;
-
-        for (const auto& m : mappings_) {
-            if (m.containerFormID == a_formID) return true;
-        }
-        return false;
+        if (a_formID == 0) return false;
+        return FindMapping(a_formID) != nullptr;
     }
 
     ContainerDisplay Resolve(RE::FormID a_formID) const override {
-        for (const auto& m : mappings_) {
-            if (m.containerFormID != a_formID) continue;
+        if (const auto* mapping = FindMapping(a_formID)) {
+            const auto& m = *mapping;
 
             auto* ref = RE::TESForm::LookupByID<RE::TESObjectREFR>(a_formID);
             bool available = false;
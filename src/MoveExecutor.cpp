@@ -0,0 +1,170 @@
+#include "MoveExecutor.h"
+#include "InventoryCache.h"
+#include "Settings.h"
+
+#include <chrono>
+#include <unordered_map>
+
+namespace MoveExecutor {
+
+    namespace {
+        struct Job {
+            std::vector<Move> moves;
+            size_t next = 0;
+            Result result;
+            CompletionCallback onComplete;
+            ProgressCallback onProgress;
+            RE::TESObjectCELL* startCell = nullptr;
+            bool cancelRequested = false;
+        };
+
+        // Game thread only
+        std::unique_ptr<Job> s_job;
+
+        // What each touched container holds, for one batch. Read fresh the first
+        // time a container is touched and kept current by the batch's own moves —
+        // nothing else runs on the game thread until the batch returns, but the
+        // player may take items between batches.
+        using Holdings = std::unordered_map<RE::FormID, std::unordered_map<RE::TESBoundObject*, int32_t>>;
+
+        std::unordered_map<RE::TESBoundObject*, int32_t>& GetHoldings(Holdings& a_holdings, RE::FormID a_formID) {
+            auto [it, inserted] = a_holdings.try_emplace(a_formID);
+            if (inserted) {
+                for (const auto& [item, count] : *InventoryCache::Get(a_formID)) {
+                    it->second[item] += count;
+                }
+            }
+            return it->second;
+        }
+
+        RE::TESObjectCELL* GetPlayerCell() {
+            auto* player = RE::PlayerCharacter::GetSingleton();
+            return player ? player->GetParentCell() : nullptr;
+        }
+
+        void Execute(const Move& a_move, Result& a_result, Holdings& a_holdings) {
+            auto* source = RE::TESForm::LookupByID<RE::TESObjectREFR>(a_move.sourceFormID);
+            auto* target = RE::TESForm::LookupByID<RE::TESObjectREFR>(a_move.targetFormID);
+            if (!source || !target || !a_move.item) {
+                logger::debug("  Skipping {}x {}: container {:08X} -> {:08X} unavailable",
+                             a_move.count, a_move.item ? a_move.item->GetName() : "(null)",
+                             a_move.sourceFormID, a_move.targetFormID);
+                return;
+            }
+
+            // The plan may be frames old — move (and report) only what the source still holds
+            auto& held = GetHoldings(a_holdings, a_move.sourceFormID)[a_move.item];
+            int32_t count = std::min(a_move.count, held);
+            if (count <= 0) {
+                logger::debug("  Skipping {}x {}: {:08X} no longer holds it",
+                             a_move.count, a_move.item->GetName(), a_move.sourceFormID);
+                return;
+            }
+
+            logger::debug("  Moving {}x {} {:08X} -> {:08X}",
+                         count, a_move.item->GetName(),
+                         a_move.sourceFormID, a_move.targetFormID);
+            source->RemoveItem(a_move.item, count, RE::ITEM_REMOVE_REASON::kStoreInContainer,
+                               nullptr, target);
+            InventoryCache::Invalidate(a_move.sourceFormID);
+            InventoryCache::Invalidate(a_move.targetFormID);
+
+            held -= count;
+            if (auto loaded = a_holdings.find(a_move.targetFormID); loaded != a_holdings.end()) {
+                loaded->second[a_move.item] += count;
+            }
+
+            a_result.itemsMoved += count;
+            if (a_move.staging) return;
+            auto it = std::find_if(a_result.perTarget.begin(), a_result.perTarget.end(),
+                                   [&](const auto& entry) { return entry.first == a_move.targetFormID; });
+            if (it != a_result.perTarget.end()) {
+                it->second += count;
+            } else {
+                a_result.perTarget.emplace_back(a_move.targetFormID, count);
+            }
+        }
+
+        void Finish() {
+            auto job = std::move(s_job);
+            logger::info("MoveExecutor: {} {} of {} moves ({} items)",
+                         job->result.cancelled ? "cancelled after" : "completed",
+                         job->next, job->moves.size(), job->result.itemsMoved);
+            if (job->onComplete) job->onComplete(job->result);
+        }
+
+        void Tick() {
+            if (!s_job) return;
+            auto& job = *s_job;
+
+            if (!job.cancelRequested && GetPlayerCell() != job.startCell) {
+                logger::info("MoveExecutor: player left the cell, cancelling");
+                job.cancelRequested = true;
+            }
+            if (job.cancelRequested) {
+                job.result.cancelled = true;
+                Finish();
+                return;
+            }
+
+            auto budget = std::chrono::duration<float, std::milli>(Settings::fSortFrameBudgetMs);
+            auto start = std::chrono::steady_clock::now();
+            Holdings holdings;
+            do {
+                Execute(job.moves[job.next++], job.result, holdings);
+            } while (job.next < job.moves.size() && std::chrono::steady_clock::now() - start < budget);
+
+            if (job.next >= job.moves.size()) {
+                Finish();
+                return;
+            }
+
+            if (job.onProgress) {
+                job.onProgress({job.next, job.moves.size(), job.result.itemsMoved});
+            }
+            SKSE::GetTaskInterface()->AddTask([]() { Tick(); });
+        }
+    }
+
+    bool Submit(std::vector<Move> a_moves,
+                CompletionCallback a_onComplete,
+                ProgressCallback a_onProgress) {
+        if (s_job) {
+            logger::warn("MoveExecutor: job already running ({}/{} moves), rejecting new job",
+                        s_job->next, s_job->moves.size());
+            return false;
+        }
+
+        if (a_moves.empty()) {
+            if (a_onComplete) a_onComplete(Result{});
+            return true;
+        }
+
+        s_job = std::make_unique<Job>();
+        s_job->moves = std::move(a_moves);
+        s_job->onComplete = std::move(a_onComplete);
+        s_job->onProgress = std::move(a_onProgress);
+        s_job->startCell = GetPlayerCell();
+
+        logger::debug("MoveExecutor: submitted {} moves", s_job->moves.size());
+        Tick();
+        return true;
+    }
+
+    Result RunNow(const std::vector<Move>& a_moves) {
+        Result result;
+        Holdings holdings;
+        for (const auto& move : a_moves) {
+            Execute(move, result, holdings);
+        }
+        return result;
+    }
+
+    bool IsBusy() {
+        return s_job != nullptr;
+    }
+
+    void Cancel() {
+        if (s_job) s_job->cancelRequested = true;
+    }
+}
@@ -1,5 +1,10 @@
 #include "ContainerRegistry.h"
 
+#include <chrono>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
 namespace {
     constexpr uint32_t COLOR_FOLLOWER = 0xFFAA66;  // Warm orange
     constexpr uint32_t COLOR_DISABLED = 0x555555;
@@ -13,6 +18,10 @@ namespace {
     constexpr uint32_t FOLLOWER_SLOT_START = 0;
     constexpr uint32_t FOLLOWER_SLOT_END = 9;
     constexpr uint32_t CONTAINER_OFFSET = 10;
+
+    // A FormID missing from the reverse index only forces a rebuild once this
+    // old (about a frame) — repeated misses for non-NFF containers stay O(1)
+    constexpr auto INDEX_MAX_AGE = std::chrono::milliseconds(16);
 }
 
 /**
@@ -20,12 +29,62 @@ namespace {
  *
  * Group 1 entries. NFF assigns each recruited follower a storage container via
  * quest aliases: follower in alias N, container in alias N+10.
- * Aliases are dynamic — NFF shuffles them at runtime — so we never cache slot
- * assignments and iterate fresh on every call.
+ * Aliases are dynamic — NFF shuffles them at runtime — so the container→slot
+ * index is only a hint: every hit is re-checked against its alias (one lookup)
+ * and a moved or missing container rebuilds it. Availability is never cached.
  */
 class NFFContainerSource : public IContainerSource {
     RE::TESQuest* quest_ = nullptr;
 
+    mutable std::mutex indexLock_;
+    mutable std::unordered_map<RE::FormID, uint32_t> slotByContainer_;
+    mutable std::chrono::steady_clock::time_point indexBuilt_{};
+
+    RE::FormID AliasFormID(uint32_t a_alias) const {
+        auto it = quest_->refAliasMap.find(a_alias);
+        if (it == quest_->refAliasMap.end()) return 0;
+        auto refPtr = it->second.get();
+        return (refPtr && refPtr.get()) ? refPtr.get()->GetFormID() : 0;
+    }
+
+    void RebuildIndex() const {
+        slotByContainer_.clear();
+        for (uint32_t i = FOLLOWER_SLOT_START; i <= FOLLOWER_SLOT_END; ++i) {
+            if (auto formID = AliasFormID(i + CONTAINER_OFFSET); formID != 0) {
+                slotByContainer_.emplace(formID, i);
+            }
+        }
+        indexBuilt_ = std::chrono::steady_clock::now();
+    }
+
+    // Follower slot whose container alias currently holds a_formID
+    std::optional<uint32_t> FindSlot(RE::FormID a_formID) const {
+        std::lock_guard lock(indexLock_);
+
+        bool fresh = false;
+        if (indexBuilt_ == std::chrono::steady_clock::time_point{}) {
+            RebuildIndex();
+            fresh = true;
+        }
+
+        auto it = slotByContainer_.find(a_formID);
+        if (it != slotByContainer_.end() &&
+            (fresh || AliasFormID(it->second + CONTAINER_OFFSET) == a_formID)) {
+            return it->second;
+        }
+
+        // Shuffled away from its slot, or possibly newly assigned
+        bool stale = it != slotByContainer_.end() ||
+                     std::chrono::steady_clock::now() - indexBuilt_ >= INDEX_MAX_AGE;
+        if (!fresh && stale) {
+            RebuildIndex();
+            if (auto rebuilt = slotByContainer_.find(a_formID); rebuilt != slotByContainer_.end()) {
+                return rebuilt->second;
+            }
+        }
+        return std::nullopt;
+    }
+
 public:
     NFFContainerSource() {
         auto* dh = RE::TESDataHandler::GetSingleton();
@@ -50,17 +109,7 @@ public:
         // Don't check the parallel follower slot here — that's Resolve's job
         // (availability). During a shuffle NFF may temporarily clear follower
         // slots while the container alias still holds the REFR.
-        for (uint32_t i = FOLLOWER_SLOT_START; i <= FOLLOWER_SLOT_END; ++i) {
-            uint32_t containerAlias = i + CONTAINER_OFFSET;
-            auto it = quest_->refAliasMap.find(containerAlias);
-            if (it != quest_->refAliasMap.end()) {
-                auto refPtr = it->second.get();
-                if (refPtr && refPtr.get() && refPtr.get()->GetFormID() == a_formID) {
-                    return true;
-                }
-            }
-        }
-        return false;
+        return FindSlot(a_formID).has_value();
     }
 
     ContainerDisplay Resolve(RE::FormID a_formID) const override {
@@ -75,13 +124,8 @@ public:
         }
 
         // Find which container slot this is, and get the follower name
-        for (uint32_t i = FOLLOWER_SLOT_START; i <= FOLLOWER_SLOT_END; ++i) {
-            uint32_t containerAlias = i + CONTAINER_OFFSET;
-            auto contIt = quest_->refAliasMap.find(containerAlias);
-            if (contIt == quest_->refAliasMap.end()) continue;
-
-            auto contPtr = contIt->second.get();
-            if (!contPtr || !contPtr.get() || contPtr.get()->GetFormID() != a_formID) continue;
+        if (auto slot = FindSlot(a_formID)) {
+            uint32_t i = *slot;
 
             // Found the container — get follower name from the parallel slot
             std::string followerName;
@@ -1,4 +1,5 @@
 #include "NetworkManager.h"
+#include "ContainerRegistry.h"
 #include "DisplayName.h"
 #include "FilterRegistry.h"
 #include "Settings.h"
@@ -126,6 +127,20 @@ void NetworkManager::SetWhooshConfig(const std::string& a_networkName, const std
     logger::debug("SetWhooshConfig: network '{}' with {} filters", a_networkName, a_filters.size());
 }
 
+void NetworkManager::SetAutoRoute(const std::string& a_networkName, bool a_enabled) {
+    std::lock_guard lock(m_lock);
+
+    auto* net = FindNetworkUnsafe(a_networkName);
+    if (!net) {
+        logger::warn("SetAutoRoute: network '{}' not found", a_networkName);
+        return;
+    }
+
+    net->autoRoute = a_enabled;
+
+    logger::debug("SetAutoRoute: network '{}' {}", a_networkName, a_enabled ? "enabled" : "disabled");
+}
+
 void NetworkManager::SetRestockConfig(const std::string& a_networkName, const RestockCategory::RestockConfig& a_config) {
     std::lock_guard lock(m_lock);
 
@@ -160,9 +175,11 @@ void NetworkManager::ClearAll() {
     m_tagRegistry.clear();
     m_recognizedMods.clear();
     m_sellState = SellContainerState{};
-    m_transactionLog.clear();
+    m_transactionLog.Clear();
+    m_salesStats.Clear();
     m_disabledContainerLists.clear();
     VendorRegistry::GetSingleton()->ClearAll();
+    ContainerRegistry::GetSingleton()->InvalidateOwnership();
     logger::info("ClearAll: all SLID data cleared");
 }
 
@@ -177,6 +194,7 @@ bool NetworkManager::TagContainer(RE::FormID a_formID, const std::string& a_cust
     } else {
         logger::debug("TagContainer: updated {:08X} to '{}'", a_formID, a_customName);
     }
+    ContainerRegistry::GetSingleton()->InvalidateOwnership();
     return true;
 }
 
@@ -188,6 +206,7 @@ bool NetworkManager::UntagContainer(RE::FormID a_formID) {
         return false;
     }
     logger::debug("UntagContainer: removed {:08X} from tag registry", a_formID);
+    ContainerRegistry::GetSingleton()->InvalidateOwnership();
     return true;
 }
 
@@ -233,6 +252,7 @@ void NetworkManager::ClearContainerReferences(RE::FormID a_formID) {
     }
 
     logger::debug("ClearContainerReferences: cleared all references to {:08X}", a_formID);
+    ContainerRegistry::GetSingleton()->InvalidateOwnership();
 }
 
 // --- Sell container ---
@@ -249,6 +269,7 @@ void NetworkManager::SetSellContainer(RE::FormID a_formID) {
     m_sellState.timerStarted = true;
     m_sellState.lastSellTime = now;
     logger::info("SetSellContainer: designated {:08X}, cooldown started at {:.1f}h", a_formID, now);
+    ContainerRegistry::GetSingleton()->InvalidateOwnership();
 }
 
 void NetworkManager::ClearSellContainer() {
@@ -262,6 +283,7 @@ void NetworkManager::ClearSellContainer() {
         logger::info("ClearSellContainer: sell container cleared (lifetime: {} items, {} gold)",
                      m_sellState.totalItemsSold, m_sellState.totalGoldEarned);
     }
+    ContainerRegistry::GetSingleton()->InvalidateOwnership();
 
     // Update display name outside lock — re-apply if container still has a role, otherwise clear
     if (oldFormID != 0) {
@@ -301,16 +323,22 @@ void NetworkManager::SetLastSellTime(float a_gameHours) {
 
 void NetworkManager::AppendTransactions(const std::vector<SaleTransaction>& a_transactions) {
     std::lock_guard lock(m_lock);
-    m_transactionLog.insert(m_transactionLog.begin(), a_transactions.begin(), a_transactions.end());
-    if (m_transactionLog.size() > kMaxTransactionLog) {
-        m_transactionLog.resize(kMaxTransactionLog);
+    m_transactionLog.SetCapacity(static_cast<size_t>(Settings::iTransactionLogSize));
+    // Newest first: the batch's first transaction ends up at index 0
+    for (auto it = a_transactions.rbegin(); it != a_transactions.rend(); ++it) {
+        m_transactionLog.Append(*it);
+        m_salesStats.Add(*it);
     }
 }
 
-const std::vector<SaleTransaction>& NetworkManager::GetTransactionLog() const {
+const TransactionLog& NetworkManager::GetTransactionLog() const {
     return m_transactionLog;
 }
 
+const SalesStats& NetworkManager::GetSalesStats() const {
+    return m_salesStats;
+}
+
 // --- Query methods ---
 
 std::string NetworkManager::FindNetworkByMaster(RE::FormID a_masterFormID) const {
@@ -452,9 +480,11 @@ void NetworkManager::Save(SKSE::SerializationInterface* a_intfc) const {
     a_intfc->WriteRecordData(&m_sellState.lastSellTime, sizeof(m_sellState.lastSellTime));
     uint8_t timerByte = m_sellState.timerStarted ? 1 : 0;
     a_intfc->WriteRecordData(&timerByte, sizeof(timerByte));
+    m_salesStats.Save(a_intfc);
 
-    logger::info("Saved sell container state (formID={:08X}, items={}, gold={})",
-                 m_sellState.formID, m_sellState.totalItemsSold, m_sellState.totalGoldEarned);
+    logger::info("Saved sell container state (formID={:08X}, items={}, gold={}, {} vendors / {} days of stats)",
+                 m_sellState.formID, m_sellState.totalItemsSold, m_sellState.totalGoldEarned,
+                 m_salesStats.byVendor.size(), m_salesStats.byDay.size());
 
     // Write transaction log record
     if (!a_intfc->OpenRecord(kTlogRecord, kTlogVersion)) {
@@ -462,31 +492,9 @@ void NetworkManager::Save(SKSE::SerializationInterface* a_intfc) const {
         return;
     }
 
-    uint32_t txCount = static_cast<uint32_t>(m_transactionLog.size());
-    a_intfc->WriteRecordData(&txCount, sizeof(txCount));
-
-    for (const auto& tx : m_transactionLog) {
-        uint16_t len;
+    m_transactionLog.Save(a_intfc);
 
-        len = static_cast<uint16_t>(tx.itemName.size());
-        a_intfc->WriteRecordData(&len, sizeof(len));
-        a_intfc->WriteRecordData(tx.itemName.data(), len);
-
-        len = static_cast<uint16_t>(tx.vendorName.size());
-        a_intfc->WriteRecordData(&len, sizeof(len));
-        a_intfc->WriteRecordData(tx.vendorName.data(), len);
-
-        len = static_cast<uint16_t>(tx.vendorAssortment.size());
-        a_intfc->WriteRecordData(&len, sizeof(len));
-        a_intfc->WriteRecordData(tx.vendorAssortment.data(), len);
-
-        a_intfc->WriteRecordData(&tx.quantity, sizeof(tx.quantity));
-        a_intfc->WriteRecordData(&tx.goldEarned, sizeof(tx.goldEarned));
-        a_intfc->WriteRecordData(&tx.pricePerUnit, sizeof(tx.pricePerUnit));
-        a_intfc->WriteRecordData(&tx.gameTime, sizeof(tx.gameTime));
-    }
-
-    logger::info("Saved {} transaction log entries to cosave", txCount);
+    logger::info("Saved {} transaction log entries to cosave", m_transactionLog.Size());
 
     // Write container list state record
     if (!a_intfc->OpenRecord(kClstRecord, kClstVersion)) {
@@ -545,6 +553,29 @@ void NetworkManager::Save(SKSE::SerializationInterface* a_intfc) const {
         logger::info("Saved {} restock configs to cosave", rstkNetCount);
     }
 
+    // Write auto-route record (names of networks with auto-route enabled)
+    if (!a_intfc->OpenRecord(kAutoRecord, kAutoVersion)) {
+        logger::error("Failed to open AUTO cosave record");
+        return;
+    }
+
+    {
+        uint32_t autoCount = 0;
+        for (const auto& net : m_networks) {
+            if (net.autoRoute) autoCount++;
+        }
+        a_intfc->WriteRecordData(&autoCount, sizeof(autoCount));
+
+        for (const auto& net : m_networks) {
+            if (!net.autoRoute) continue;
+            uint16_t nameLen = static_cast<uint16_t>(net.name.size());
+            a_intfc->WriteRecordData(&nameLen, sizeof(nameLen));
+            a_intfc->WriteRecordData(net.name.data(), nameLen);
+        }
+
+        logger::info("Saved {} auto-route networks to cosave", autoCount);
+    }
+
     // Write vendor registry record
     VendorRegistry::GetSingleton()->Save(a_intfc);
 }
@@ -577,6 +608,9 @@ void NetworkManager::Load(SKSE::SerializationInterface* a_intfc) {
             case kRstkRecord:
                 LoadRestockConfig(a_intfc, version);
                 break;
+            case kAutoRecord:
+                LoadAutoRoute(a_intfc, version);
+                break;
             case VendorRegistry::kVendorRecord:
                 VendorRegistry::GetSingleton()->Load(a_intfc, version);
                 break;
@@ -593,7 +627,8 @@ void NetworkManager::Revert() {
     m_tagRegistry.clear();
     m_recognizedMods.clear();
     m_sellState = SellContainerState{};
-    m_transactionLog.clear();
+    m_transactionLog.Clear();
+    m_salesStats.Clear();
     m_disabledContainerLists.clear();
     VendorRegistry::GetSingleton()->Revert();
     logger::info("Cosave state reverted");
@@ -718,6 +753,9 @@ NetworkManager::ValidationResult NetworkManager::ValidateNetworks() {
         }
     }
 
+    if (result.prunedTags > 0 || result.prunedSell) {
+        ContainerRegistry::GetSingleton()->InvalidateOwnership();
+    }
     return result;
 }
 
@@ -1233,6 +1271,7 @@ void NetworkManager::LoadConfigFromINI() {
     if (containerListsLoaded > 0) {
         logger::info("NetworkManager::LoadConfigFromINI: {} container lists loaded", containerListsLoaded);
     }
+    ContainerRegistry::GetSingleton()->InvalidateOwnership();
 }
 
 void NetworkManager::ReloadPresets() {
@@ -1275,7 +1314,13 @@ void NetworkManager::DumpToLog() const {
     logger::info("Sell container: formID={:08X}, items={}, gold={}, timer={}, lastTime={}",
                  m_sellState.formID, m_sellState.totalItemsSold, m_sellState.totalGoldEarned,
                  m_sellState.timerStarted, m_sellState.lastSellTime);
-    logger::info("Transaction log: {} entries", m_transactionLog.size());
+    logger::info("Transaction log: {} / {} entries", m_transactionLog.Size(), m_transactionLog.Capacity());
+    logger::info("Sales stats: {} items for {} gold (avg {:.2f}), top buyer '{}', best day {}",
+                 m_salesStats.total.items, m_salesStats.total.gold, m_salesStats.total.AveragePrice(),
+                 m_salesStats.topVendor, m_salesStats.bestDay);
+    for (const auto& [type, totals] : m_salesStats.byFormType) {
+        logger::info("  {}: {} items, {} gold", RE::FormTypeToString(type), totals.items, totals.gold);
+    }
 
     logger::info("Presets: {} loaded", m_presets.size());
     for (const auto& p : m_presets) {
@@ -1337,6 +1382,7 @@ void NetworkManager::SetContainerListEnabled(const std::string& a_name, bool a_e
         m_disabledContainerLists.insert(a_name);
         logger::info("SetContainerListEnabled: disabled '{}'", a_name);
     }
+    ContainerRegistry::GetSingleton()->InvalidateOwnership();
 }
 
 bool NetworkManager::ActivatePreset(const std::string& a_name) {
@@ -1691,6 +1737,11 @@ void NetworkManager::LoadSell(SKSE::SerializationInterface* a_intfc, uint32_t a_
     a_intfc->ReadRecordData(&timerByte, sizeof(timerByte));
     m_sellState.timerStarted = (timerByte != 0);
 
+    // v2: whole-save sales stats
+    if (a_version >= 2) {
+        m_salesStats.Load(a_intfc);
+    }
+
     if (savedFormID != 0) {
         RE::FormID resolvedID = 0;
         if (a_intfc->ResolveFormID(savedFormID, resolvedID)) {
@@ -1714,43 +1765,21 @@ void NetworkManager::LoadTransactionLog(SKSE::SerializationInterface* a_intfc, u
         return;
     }
 
-    uint32_t txCount = 0;
-    a_intfc->ReadRecordData(&txCount, sizeof(txCount));
-
-    // Cap to max in case of corruption
-    if (txCount > kMaxTransactionLog) {
-        logger::warn("Transaction log has {} entries (max {}), truncating", txCount, kMaxTransactionLog);
-        txCount = static_cast<uint32_t>(kMaxTransactionLog);
-    }
-
-    m_transactionLog.clear();
-    m_transactionLog.reserve(txCount);
-
-    for (uint32_t i = 0; i < txCount; ++i) {
-        SaleTransaction tx;
-        uint16_t len;
-
-        a_intfc->ReadRecordData(&len, sizeof(len));
-        tx.itemName.resize(len);
-        a_intfc->ReadRecordData(tx.itemName.data(), len);
+    m_transactionLog.SetCapacity(static_cast<size_t>(Settings::iTransactionLogSize));
+    m_transactionLog.Load(a_intfc, a_version);
 
-        a_intfc->ReadRecordData(&len, sizeof(len));
-        tx.vendorName.resize(len);
-        a_intfc->ReadRecordData(tx.vendorName.data(), len);
-
-        a_intfc->ReadRecordData(&len, sizeof(len));
-        tx.vendorAssortment.resize(len);
-        a_intfc->ReadRecordData(tx.vendorAssortment.data(), len);
-
-        a_intfc->ReadRecordData(&tx.quantity, sizeof(tx.quantity));
-        a_intfc->ReadRecordData(&tx.goldEarned, sizeof(tx.goldEarned));
-        a_intfc->ReadRecordData(&tx.pricePerUnit, sizeof(tx.pricePerUnit));
-        a_intfc->ReadRecordData(&tx.gameTime, sizeof(tx.gameTime));
-
-        m_transactionLog.push_back(std::move(tx));
+    // Saves from before SELL v2 have no stats; seed them from the history we have
+    if (m_salesStats.Empty()) {
+        for (size_t i = m_transactionLog.Size(); i-- > 0;) {
+            const auto& record = m_transactionLog[i];
+            auto* form = RE::TESForm::LookupByID(record.itemFormID);
+            m_salesStats.Add(m_transactionLog.GetString(record.vendorID),
+                             form ? form->GetFormType() : RE::FormType::None,
+                             record.quantity, record.goldEarned, record.gameTime);
+        }
     }
 
-    logger::info("Loaded {} transaction log entries from cosave", m_transactionLog.size());
+    logger::info("Loaded {} transaction log entries from cosave (v{})", m_transactionLog.Size(), a_version);
 }
 
 void NetworkManager::LoadContainerListState(SKSE::SerializationInterface* a_intfc, uint32_t a_version) {
@@ -1872,3 +1901,32 @@ void NetworkManager::LoadRestockConfig(SKSE::SerializationInterface* a_intfc, ui
 
     logger::info("Loaded restock config for {}/{} networks from cosave", matched, netCount);
 }
+
+void NetworkManager::LoadAutoRoute(SKSE::SerializationInterface* a_intfc, uint32_t a_version) {
+    if (a_version > kAutoVersion) {
+        logger::warn("AUTO cosave version {} is newer than supported {}, skipping",
+                     a_version, kAutoVersion);
+        return;
+    }
+
+    uint32_t netCount = 0;
+    a_intfc->ReadRecordData(&netCount, sizeof(netCount));
+
+    uint32_t matched = 0;
+    for (uint32_t i = 0; i < netCount; ++i) {
+        uint16_t nameLen = 0;
+        a_intfc->ReadRecordData(&nameLen, sizeof(nameLen));
+        std::string netName(nameLen, '\0');
+        a_intfc->ReadRecordData(netName.data(), nameLen);
+
+        auto* net = FindNetworkUnsafe(netName);
+        if (net) {
+            net->autoRoute = true;
+            matched++;
+        } else {
+            logger::debug("AUTO: skipping unknown network '{}'", netName);
+        }
+    }
+
+    logger::info("Loaded auto-route for {}/{} networks from cosave", matched, netCount);
+}
@@ -1,4 +1,5 @@
 #include "OriginPanel.h"
+#include "InventoryCache.h"
 #include "MenuLayout.h"
 #include "ScaleformUtil.h"
 
@@ -134,14 +135,7 @@ namespace OriginPanel {
         a_movie->SetVariable((basePath + ".containerText.text").c_str(), contVal);
 
         // Count total items in master container
-        int masterItemCount = 0;
-        if (masterRef) {
-            auto inv = masterRef->GetInventory();
-            for (auto& [item, data] : inv) {
-                if (!item || data.first <= 0 || IsPhantomItem(item)) continue;
-                masterItemCount += data.first;
-            }
-        }
+        int masterItemCount = masterRef ? InventoryCache::CountItems(masterRef->GetFormID()) : 0;
         std::string originCount = std::to_string(masterItemCount);
         cntVal.SetString(originCount.c_str());
         a_movie->SetVariable((basePath + ".countText.text").c_str(), cntVal);
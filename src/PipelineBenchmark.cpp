@@ -0,0 +1,127 @@
+#include "PipelineBenchmark.h"
+#include "Distributor.h"
+#include "FilterRegistry.h"
+#include "RestockCategory.h"
+#include "TraitCache.h"
+
+namespace PipelineBenchmark {
+
+    namespace {
+        // Never a real ref: mod index FE light-plugin space, unused index
+        constexpr RE::FormID kFakeMaster = 0xFEFFF000;
+
+        using Clock = std::chrono::steady_clock;
+
+        template <class T>
+        void Collect(RE::TESDataHandler* a_handler, std::vector<RE::TESBoundObject*>& a_out) {
+            for (auto* form : a_handler->GetFormArray<T>()) {
+                if (!form || IsPhantomItem(form)) continue;
+                const char* name = form->GetName();
+                if (!name || name[0] == '\0') continue;
+                a_out.push_back(form);
+            }
+        }
+
+        std::vector<RE::TESBoundObject*> CollectForms() {
+            std::vector<RE::TESBoundObject*> forms;
+            auto* handler = RE::TESDataHandler::GetSingleton();
+            if (!handler) return forms;
+
+            Collect<RE::TESObjectWEAP>(handler, forms);
+            Collect<RE::TESObjectARMO>(handler, forms);
+            Collect<RE::AlchemyItem>(handler, forms);
+            Collect<RE::IngredientItem>(handler, forms);
+            Collect<RE::TESObjectBOOK>(handler, forms);
+            Collect<RE::ScrollItem>(handler, forms);
+            Collect<RE::TESAmmo>(handler, forms);
+            Collect<RE::TESSoulGem>(handler, forms);
+            Collect<RE::TESObjectMISC>(handler, forms);
+            return forms;
+        }
+
+        void Report(const char* a_label, Clock::duration a_elapsed, size_t a_items) {
+            auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(a_elapsed).count();
+            logger::info("  {:<16} {:>10.2f} ms  {:>8.1f} ns/item",
+                         a_label, static_cast<double>(ns) / 1e6,
+                         a_items ? static_cast<double>(ns) / static_cast<double>(a_items) : 0.0);
+        }
+    }
+
+    void Run(uint32_t a_itemCount) {
+        if (a_itemCount == 0) a_itemCount = 10000;
+
+        auto forms = CollectForms();
+        if (forms.empty()) {
+            logger::warn("PipelineBenchmark: no item forms loaded");
+            return;
+        }
+
+        auto* registry = FilterRegistry::GetSingleton();
+
+        // Every family root linked to its own fake container, catch-all last
+        std::vector<FilterStage> stages;
+        RE::FormID nextContainer = kFakeMaster + 1;
+        for (const auto& rootID : registry->GetFamilyRoots()) {
+            stages.push_back({rootID, nextContainer++});
+        }
+        stages.push_back({FilterRegistry::kCatchAllFilterID, nextContainer++});
+
+        const auto& filters = registry->GetFilters();
+
+        std::vector<Distributor::PoolItem> pool;
+        pool.reserve(a_itemCount);
+        for (uint32_t i = 0; i < a_itemCount; ++i) {
+            pool.push_back({forms[i % forms.size()], 1});
+        }
+
+        logger::info("PipelineBenchmark: {} items ({} distinct forms), {} filters, {} stages",
+                     pool.size(), std::min<size_t>(forms.size(), pool.size()), filters.size(), stages.size());
+
+        // Match: every filter per item. Matches() memoizes traits in TraitCache,
+        // so the cold lap starts from an empty cache and the warm lap reuses it
+        size_t matches = 0;
+        auto matchPass = [&]() {
+            matches = 0;
+            for (const auto& entry : pool) {
+                for (auto* filter : filters) {
+                    if (filter->Matches(entry.item)) ++matches;
+                }
+            }
+        };
+
+        TraitCache::Clear();
+        auto start = Clock::now();
+        matchPass();
+        Report("Match (cold)", Clock::now() - start, pool.size());
+
+        start = Clock::now();
+        matchPass();
+        Report("Match (warm)", Clock::now() - start, pool.size());
+
+        // Pipeline: cold pass builds the route table, warm pass reuses it
+        Distributor::ClearRouteTables();
+        start = Clock::now();
+        Distributor::RunPipeline(stages, kFakeMaster, pool, false);
+        Report("Pipeline (cold)", Clock::now() - start, pool.size());
+
+        start = Clock::now();
+        auto warm = Distributor::RunPipeline(stages, kFakeMaster, pool, false);
+        Report("Pipeline (warm)", Clock::now() - start, pool.size());
+
+        // Classify: Restock's per-item categorization
+        size_t classified = 0;
+        start = Clock::now();
+        for (const auto& entry : pool) {
+            if (RestockCategory::Lookup(entry.item).category != RestockCategory::kNoCategory) ++classified;
+        }
+        Report("Classify", Clock::now() - start, pool.size());
+
+        int32_t claimed = 0;
+        for (const auto& outcome : warm.filterOutcomes) claimed += outcome.claimedCount;
+        logger::info("PipelineBenchmark: {} filter matches, {} claimed by pipeline, {} classified",
+                     matches, claimed, classified);
+
+        // The fake master's table must not linger next to real ones
+        Distributor::ClearRouteTables();
+    }
+}
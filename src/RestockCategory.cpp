@@ -1,5 +1,6 @@
 #include "RestockCategory.h"
 
+#include <mutex>
 #include <unordered_map>
 
 namespace RestockCategory {
@@ -332,12 +333,12 @@ namespace RestockCategory {
         float magnitude = 0.0f;
     };
 
-    static EffectMatch ClassifyAlchemy(RE::AlchemyItem* a_alch) {
+    static EffectMatch ClassifyAlchemy(RE::AlchemyItem* a_alch, bool a_log) {
         if (!a_alch) return {};
 
         // Poison check first (before iterating effects)
         if (a_alch->IsPoison()) {
-            logger::debug("  Classify '{}' {:08X}: IsPoison -> poisons",
+            if (a_log) logger::debug("  Classify '{}' {:08X}: IsPoison -> poisons",
                          a_alch->GetName(), a_alch->GetFormID());
             return {"poisons", 0.0f};
         }
@@ -346,11 +347,11 @@ namespace RestockCategory {
         if (a_alch->IsFood()) {
             auto* useSound = a_alch->data.consumptionSound;
             if (useSound && useSound->GetFormID() == kDrinkSoundFormID) {
-                logger::debug("  Classify '{}' {:08X}: IsFood + drink sound -> food_drinks",
+                if (a_log) logger::debug("  Classify '{}' {:08X}: IsFood + drink sound -> food_drinks",
                              a_alch->GetName(), a_alch->GetFormID());
                 return {"food_drinks", 0.0f};
             }
-            logger::debug("  Classify '{}' {:08X}: IsFood -> food_cooked",
+            if (a_log) logger::debug("  Classify '{}' {:08X}: IsFood -> food_cooked",
                          a_alch->GetName(), a_alch->GetFormID());
             return {"food_cooked", 0.0f};
         }
@@ -382,7 +383,7 @@ namespace RestockCategory {
             using Archetype = RE::EffectSetting::Archetype;
             using Flag = RE::EffectSetting::EffectSettingData::Flag;
 
-            logger::debug("  Classify '{}' {:08X}: effect '{}' archetype={} av={} mag={:.0f} dur={} flags={:08X}",
+            if (a_log) logger::debug("  Classify '{}' {:08X}: effect '{}' archetype={} av={} mag={:.0f} dur={} flags={:08X}",
                          a_alch->GetName(), a_alch->GetFormID(),
                          mgef->GetFullName(),
                          static_cast<int>(archetype),
@@ -542,6 +543,7 @@ namespace RestockCategory {
         else if (!bestResist.categoryID.empty())   result = bestResist;
         else if (!bestFortify.categoryID.empty())  result = bestFortify;
 
+        if (!a_log) return result;
         if (result.categoryID.empty()) {
             logger::debug("  Classify '{}' {:08X}: no matching effect category",
                          a_alch->GetName(), a_alch->GetFormID());
@@ -553,7 +555,7 @@ namespace RestockCategory {
         return result;
     }
 
-    std::string Classify(RE::TESBoundObject* a_item) {
+    static std::string ClassifyUncached(RE::TESBoundObject* a_item, bool a_log) {
         if (!a_item) return "";
 
         auto formType = a_item->GetFormType();
@@ -597,13 +599,124 @@ namespace RestockCategory {
         // Alchemy items (potions, poisons, food, drinks)
         if (formType == RE::FormType::AlchemyItem) {
             auto* alch = a_item->As<RE::AlchemyItem>();
-            auto match = ClassifyAlchemy(alch);
+            auto match = ClassifyAlchemy(alch, a_log);
             return match.categoryID;
         }
 
         return "";
     }
 
+    // ---- Classification table ----
+    // Alchemy, ammo and soul gem results depend only on the base form, so
+    // they are computed once at kDataLoaded. Player-made potions (FF-prefixed)
+    // don't exist yet at that point; they are classified on first sight and
+    // kept with the form pointer, since dynamic FormIDs can be reused.
+
+    static std::unordered_map<RE::FormID, Classification> s_table;  // read-only after BuildTable()
+    static bool s_tableBuilt = false;
+
+    struct DynamicEntry {
+        RE::TESBoundObject* item = nullptr;
+        Classification classification;
+    };
+    static std::mutex s_dynamicLock;
+    static std::unordered_map<RE::FormID, DynamicEntry> s_dynamic;
+
+    static bool IsTabledType(RE::FormType a_type) {
+        return a_type == RE::FormType::AlchemyItem ||
+               a_type == RE::FormType::Ammo ||
+               a_type == RE::FormType::SoulGem;
+    }
+
+    static Classification Compute(RE::TESBoundObject* a_item, bool a_log) {
+        auto id = ClassifyUncached(a_item, a_log);
+        if (id.empty()) return {};
+        return {GetCategoryIndex(id), QualityScore(a_item, id)};
+    }
+
+    CategoryIndex GetCategoryIndex(const std::string& a_id) {
+        static const std::unordered_map<std::string, CategoryIndex> indices = []() {
+            std::unordered_map<std::string, CategoryIndex> map;
+            const auto& cats = GetAllCategories();
+            for (size_t i = 0; i < cats.size(); ++i) {
+                map.emplace(cats[i].id, static_cast<CategoryIndex>(i));
+            }
+            return map;
+        }();
+        auto it = indices.find(a_id);
+        return it != indices.end() ? it->second : kNoCategory;
+    }
+
+    void BuildTable() {
+        auto* handler = RE::TESDataHandler::GetSingleton();
+        if (!handler) return;
+
+        auto start = std::chrono::steady_clock::now();
+        s_table.clear();
+        size_t scanned = 0;
+        auto add = [&](RE::TESBoundObject* a_form) {
+            if (!a_form) return;
+            ++scanned;
+            auto classification = Compute(a_form, false);
+            if (classification.category != kNoCategory) {
+                s_table.emplace(a_form->GetFormID(), classification);
+            }
+        };
+        for (auto* form : handler->GetFormArray<RE::AlchemyItem>()) add(form);
+        for (auto* form : handler->GetFormArray<RE::TESAmmo>()) add(form);
+        for (auto* form : handler->GetFormArray<RE::TESSoulGem>()) add(form);
+        s_tableBuilt = true;
+
+        auto ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+        logger::info("RestockCategory: classified {} of {} alchemy/ammo/soul gem forms in {:.1f} ms",
+                     s_table.size(), scanned, ms);
+    }
+
+    void ClearDynamic() {
+        std::lock_guard lock(s_dynamicLock);
+        s_dynamic.clear();
+    }
+
+    Classification Lookup(RE::TESBoundObject* a_item) {
+        if (!a_item) return {};
+
+        auto formType = a_item->GetFormType();
+        auto formID = a_item->GetFormID();
+
+        if (IsTabledType(formType)) {
+            if ((formID >> 24) == 0xFF) {
+                std::lock_guard lock(s_dynamicLock);
+                auto& entry = s_dynamic[formID];
+                if (entry.item != a_item) {
+                    entry = {a_item, Compute(a_item, true)};
+                }
+                return entry.classification;
+            }
+            if (s_tableBuilt) {
+                auto it = s_table.find(formID);
+                return it != s_table.end() ? it->second : Classification{};
+            }
+            return Compute(a_item, true);
+        }
+
+        // Torches and firewood: no table needed
+        if (formType == RE::FormType::Light) {
+            static const auto torches = GetCategoryIndex("supplies_torches");
+            return {torches, 0.0f};
+        }
+        if (formID == kFirewoodFormID) {
+            static const auto firewood = GetCategoryIndex("supplies_firewood");
+            return {firewood, 0.0f};
+        }
+        return {};
+    }
+
+    std::string Classify(RE::TESBoundObject* a_item) {
+        auto classification = Lookup(a_item);
+        if (classification.category == kNoCategory) return "";
+        return GetAllCategories()[classification.category].id;
+    }
+
     float QualityScore(RE::TESBoundObject* a_item, [[maybe_unused]] const std::string& a_categoryID) {
         if (!a_item) return 0.0f;
 
@@ -1,5 +1,6 @@
 #include "RestockConfigMenu.h"
 #include "ButtonBar.h"
+#include "Distributor.h"
 #include "MouseGlow.h"
 #include "ScaleformUtil.h"
 #include "TranslationService.h"
@@ -15,6 +16,7 @@ namespace RestockConfig {
     // Static state
     Menu::Callback Menu::s_callback;
     RestockCategory::RestockConfig Menu::s_initialConfig;
+    std::string Menu::s_networkName;
 
     // --- Registration ---
 
@@ -98,9 +100,11 @@ namespace RestockConfig {
 
     // --- Show / Hide ---
 
-    void Menu::Show(const RestockCategory::RestockConfig& a_initial, Callback a_callback) {
+    void Menu::Show(const RestockCategory::RestockConfig& a_initial, Callback a_callback,
+                    const std::string& a_networkName) {
         s_initialConfig = a_initial;
         s_callback = std::move(a_callback);
+        s_networkName = a_networkName;
 
         auto ui = RE::UI::GetSingleton();
         if (ui && !ui->IsMenuOpen(MENU_NAME)) {
@@ -241,6 +245,20 @@ namespace RestockConfig {
         return config;
     }
 
+    void Menu::RefreshPreview() {
+        if (s_networkName.empty()) return;
+
+        auto config = AssembleConfig();
+        if (m_previewValid && config.itemQuantities == m_previewQuantities) return;
+
+        m_previewQuantities = config.itemQuantities;
+        m_previewPlanned.assign(RestockCategory::GetAllCategories().size(), 0);
+        for (const auto& entry : Distributor::PlanRestock(s_networkName, config).categories) {
+            m_previewPlanned[entry.category] = entry.planned;
+        }
+        m_previewValid = true;
+    }
+
     // --- Navigation helpers ---
 
     bool Menu::IsBrowserRowVisible(int a_index) const {
@@ -648,6 +666,7 @@ namespace RestockConfig {
             RemoveClip("_rsP_Plus" + std::to_string(i));
             RemoveClip("_rsP_PlusHL" + std::to_string(i));
             RemoveClip("_rsP_Lbl" + std::to_string(i));
+            RemoveClip("_rsP_Prev" + std::to_string(i));
             RemoveClip("_rsP_Trash" + std::to_string(i));
             RemoveClip("_rsP_TrashHL" + std::to_string(i));
         }
@@ -681,6 +700,8 @@ namespace RestockConfig {
             return;
         }
 
+        RefreshPreview();
+
         int startRow = m_padScroll;
         int endRow = std::min(startRow + visRows, static_cast<int>(m_padRows.size()));
 
@@ -801,19 +822,28 @@ namespace RestockConfig {
             }
             cx += QTY_BTN_W + 4.0;
 
-            // Label — leave room for trash icon on right
+            // Label — leave room for preview and trash icon on right
             std::string lblName = "_rsP_Lbl" + std::to_string(slot);
             std::string label = row.label;
-            double labelW = PAD_W - (cx - m_padX) - TRASH_W - 10.0;
-            if (label.length() > 34) {
-                label = label.substr(0, 32) + "..";
+            double labelW = PAD_W - (cx - m_padX) - PREVIEW_W - TRASH_W - 10.0;
+            if (label.length() > 30) {
+                label = label.substr(0, 28) + "..";
             }
             ScaleformUtil::CreateLabel(uiMovie.get(), lblName.c_str(), labelDepth + 300,
                 cx, y + 2.0, labelW, ROW_H, label.c_str(), 11, COLOR_ITEM);
 
+            // Restock preview: items the next Restock would pull for this row
+            double trashX = m_padX + PAD_W - TRASH_W - 6.0;
+            auto catIndex = RestockCategory::GetCategoryIndex(row.id);
+            if (m_previewValid && catIndex != RestockCategory::kNoCategory && m_previewPlanned[catIndex] > 0) {
+                std::string prevName = "_rsP_Prev" + std::to_string(slot);
+                std::string prevStr = "+" + std::to_string(m_previewPlanned[catIndex]);
+                ScaleformUtil::CreateLabel(uiMovie.get(), prevName.c_str(), labelDepth + 350,
+                    trashX - PREVIEW_W, y + 2.0, PREVIEW_W, ROW_H, prevStr.c_str(), 10, COLOR_PREVIEW);
+            }
+
             // Trash icon "x" on right side of row
             bool trashHovered = (m_hoverTrashRow == r);
-            double trashX = m_padX + PAD_W - TRASH_W - 6.0;
             std::string trashName = "_rsP_Trash" + std::to_string(slot);
             ScaleformUtil::CreateLabel(uiMovie.get(), trashName.c_str(), labelDepth + 400,
                 trashX, y + 2.0, TRASH_W, ROW_H, "x", 10,
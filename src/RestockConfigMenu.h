@@ -7,6 +7,7 @@
 
 #include <chrono>
 #include <functional>
+#include <map>
 #include <string>
 #include <vector>
 
@@ -30,6 +31,7 @@ namespace RestockConfig {
     constexpr double QTY_BTN_W     = 20.0;
     constexpr double QTY_NUM_W     = 32.0;
     constexpr double TRASH_W       = 20.0;   // trash icon hit zone width
+    constexpr double PREVIEW_W     = 36.0;   // "+N" Restock preview column
 
     // Colors
     constexpr uint32_t COLOR_BG           = 0x0A0A0A;
@@ -49,6 +51,7 @@ namespace RestockConfig {
     constexpr uint32_t COLOR_QTY_ADJUST   = 0xDDB866;  // gold qty in adjust mode
     constexpr uint32_t COLOR_QTY_BTN      = 0x888888;
     constexpr uint32_t COLOR_QTY_BTN_HOVER = 0xDDDDDD;
+    constexpr uint32_t COLOR_PREVIEW      = 0x88AACC;  // items the next Restock would pull
     constexpr uint32_t COLOR_PAD_EMPTY    = 0x555555;
     constexpr uint32_t COLOR_DIVIDER      = 0x444444;
     constexpr uint32_t COLOR_SCROLLTRACK  = 0x333333;
@@ -98,9 +101,11 @@ namespace RestockConfig {
         void PostCreate() override;
         RE::UI_MESSAGE_RESULTS ProcessMessage(RE::UIMessage& a_message) override;
 
-        // Show with initial config and callback
+        // Show with initial config and callback. With a network name, each pad
+        // row previews how many items Restock would pull for the edited config.
         using Callback = std::function<void(bool, RestockCategory::RestockConfig)>;
-        static void Show(const RestockCategory::RestockConfig& a_initial, Callback a_callback);
+        static void Show(const RestockCategory::RestockConfig& a_initial, Callback a_callback,
+                         const std::string& a_networkName = {});
         static void Hide();
         static bool IsOpen();
 
@@ -134,6 +139,7 @@ namespace RestockConfig {
     private:
         static Callback s_callback;
         static RestockCategory::RestockConfig s_initialConfig;
+        static std::string s_networkName;
 
         // Focus
         FocusTarget m_focus = FocusTarget::kBrowser;
@@ -167,6 +173,12 @@ namespace RestockConfig {
         // Input device mode
         bool m_gamepad = false;
 
+        // Restock preview — planned pull per category index, recomputed when the pad changes
+        std::map<std::string, uint16_t> m_previewQuantities;
+        std::vector<int32_t> m_previewPlanned;
+        bool m_previewValid = false;
+        void RefreshPreview();
+
         // Button bar
         ButtonBar m_buttonBar;
         int m_btnIndex = 0;
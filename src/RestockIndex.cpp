@@ -0,0 +1,40 @@
+#include "RestockIndex.h"
+#include "InventoryCache.h"
+
+namespace RestockIndex {
+
+    namespace {
+        struct Entry {
+            std::shared_ptr<const InventoryCache::Snapshot> source;
+            ContainerIndex index;
+        };
+
+        std::unordered_map<RE::FormID, Entry> s_entries;
+
+        void Build(const InventoryCache::Snapshot& a_snapshot, ContainerIndex& a_index) {
+            a_index = {};
+            for (const auto& [item, count] : a_snapshot) {
+                auto classification = RestockCategory::Lookup(item);
+                if (classification.category == RestockCategory::kNoCategory) continue;
+
+                a_index.categories.set(classification.category);
+                a_index.holdings[classification.category].push_back({item, count, classification.quality});
+                a_index.totals[classification.category] += count;
+            }
+        }
+    }
+
+    const ContainerIndex& Get(RE::FormID a_formID) {
+        auto snapshot = InventoryCache::Get(a_formID);
+        auto& entry = s_entries[a_formID];
+        if (entry.source != snapshot) {
+            Build(*snapshot, entry.index);
+            entry.source = std::move(snapshot);
+        }
+        return entry.index;
+    }
+
+    void Clear() {
+        s_entries.clear();
+    }
+}
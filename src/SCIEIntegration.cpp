@@ -1,4 +1,5 @@
 #include "SCIEIntegration.h"
+#include "ContainerRegistry.h"
 
 namespace SCIEIntegration {
 
@@ -36,6 +37,7 @@ namespace SCIEIntegration {
                     g_hasCache = true;
                     logger::info("SCIEIntegration: received empty container list from SCIE");
                 }
+                ContainerRegistry::GetSingleton()->InvalidateOwnership();
             }
         }
     }
@@ -99,6 +101,7 @@ namespace SCIEIntegration {
     void ClearCache() {
         g_cachedContainers.clear();
         g_hasCache = false;
+        ContainerRegistry::GetSingleton()->InvalidateOwnership();
         logger::debug("SCIEIntegration: cache cleared");
     }
 
@@ -25,6 +25,10 @@ namespace SLIDMenu {
 
     // Active menu instance (set on open, cleared on close)
     static ConfigMenu* g_activeMenu = nullptr;
+    static uint32_t g_menuInstance = 0;  // bumped per open; lets deferred callbacks detect a reopened menu
+
+    // Prediction snapshot reused across edits while the menu is open
+    static std::unique_ptr<Distributor::PredictionSession> g_predictionSession;
 
     // --- Helpers for contextual defaults dialog ---
 
@@ -114,6 +118,7 @@ namespace SLIDMenu {
     void ConfigMenu::PostCreate() {
         if (!uiMovie) return;
         g_activeMenu = this;
+        ++g_menuInstance;
 
         // Initialize FilterPanel with movie, network context, and callbacks
         FilterPanel::Callbacks cb{
@@ -375,7 +380,10 @@ namespace SLIDMenu {
         // Append catch-all as the last filter stage for unified pipeline
         filters.push_back(FilterStage{FilterRegistry::kCatchAllFilterID, catchAllFormID});
 
-        auto prediction = Distributor::PredictDistribution(masterFormID, filters);
+        if (!g_predictionSession || g_predictionSession->GetMasterFormID() != masterFormID) {
+            g_predictionSession = std::make_unique<Distributor::PredictionSession>(masterFormID);
+        }
+        auto prediction = g_predictionSession->Predict(filters);
 
         // Pop catch-all prediction (last entry) before passing to FilterPanel
         int catchAllPrediction = 0;
@@ -433,9 +441,24 @@ namespace SLIDMenu {
 
         int oldOriginCount = FilterPanel::GetCurrentOriginCount();
 
-        auto result = Distributor::Distribute(networkName);
-        logger::info("Sort complete: {} items moved", result.totalItems);
+        // Moves may span several frames — the menu can close before they finish
+        auto menuInstance = g_menuInstance;
+        bool started = Distributor::DistributeAsync(networkName,
+            [menuInstance, oldFilterCounts, oldCatchAllCount, oldOriginCount](
+                const Distributor::DistributeResult& a_result) {
+                logger::info("Sort complete: {} items moved", a_result.totalItems);
+                if (!g_activeMenu || g_menuInstance != menuInstance) return;
+                g_activeMenu->FinishSort(a_result, oldFilterCounts, oldCatchAllCount, oldOriginCount);
+            }, Distributor::MakeSortProgressNotifier());
+        if (!started) {
+            logger::debug("RunSort: Sort not started (network missing or move job in progress)");
+            Feedback::NotifyIfMoveBusy();
+        }
+    }
 
+    void ConfigMenu::FinishSort(const Distributor::DistributeResult& a_result,
+                                const std::vector<int>& a_oldFilterCounts,
+                                int a_oldCatchAllCount, int a_oldOriginCount) {
         BuildStagesFromNetwork();
         RecalcPredictions();
 
@@ -444,16 +467,16 @@ namespace SLIDMenu {
         auto& newRows = FilterPanel::GetFilterRows();
         int filterCount = static_cast<int>(newRows.size());
         for (int i = 0; i < filterCount; i++) {
-            int oldCount = (i < static_cast<int>(oldFilterCounts.size())) ? oldFilterCounts[i] : 0;
+            int oldCount = (i < static_cast<int>(a_oldFilterCounts.size())) ? a_oldFilterCounts[i] : 0;
             if (newRows[i].GetData().count != oldCount) flashIndices.insert(i);
         }
         // Check catch-all
         int newCatchAllCount = ContainerRegistry::GetSingleton()->CountItems(
             CatchAllPanel::GetContainerFormID());
-        if (newCatchAllCount != oldCatchAllCount) flashIndices.insert(filterCount);
+        if (newCatchAllCount != a_oldCatchAllCount) flashIndices.insert(filterCount);
 
         int newOriginCount = FilterPanel::GetCurrentOriginCount();
-        if (newOriginCount != oldOriginCount) flashIndices.insert(-1);
+        if (newOriginCount != a_oldOriginCount) flashIndices.insert(-1);
 
         // Remove catch-all flash from the set before passing to FilterPanel
         bool catchAllFlash = flashIndices.count(filterCount) > 0;
@@ -464,8 +487,11 @@ namespace SLIDMenu {
         }
         OriginPanel::SetCount(uiMovie.get(), newOriginCount, flashIndices.count(-1) > 0);
 
-        if (result.totalItems > 0) {
-            std::string msg = TF("$SLID_NotifySorted", std::to_string(result.totalItems));
+        if (a_result.cancelled) {
+            std::string msg = TF("$SLID_NotifySortInterrupted", std::to_string(a_result.totalItems));
+            RE::DebugNotification(msg.c_str());
+        } else if (a_result.totalItems > 0) {
+            std::string msg = TF("$SLID_NotifySorted", std::to_string(a_result.totalItems));
             RE::DebugNotification(msg.c_str());
         } else {
             RE::DebugNotification(T("$SLID_NothingToSort").c_str());
@@ -473,6 +499,7 @@ namespace SLIDMenu {
     }
 
     void ConfigMenu::RunSweep() {
+        if (Feedback::NotifyIfMoveBusy()) return;  // Sort still moving items
         auto networkName = ConfigState::GetNetworkName();
 
         // Snapshot old counts for flash detection
@@ -521,6 +548,7 @@ namespace SLIDMenu {
     }
 
     void ConfigMenu::RunWhoosh() {
+        if (Feedback::NotifyIfMoveBusy()) return;  // Sort still moving items
         auto networkName = ConfigState::GetNetworkName();
         auto* mgr = NetworkManager::GetSingleton();
         auto* net = mgr->FindNetwork(networkName);
@@ -533,6 +561,7 @@ namespace SLIDMenu {
                 auto nm = ConfigState::GetNetworkName();
                 auto* nmgr = NetworkManager::GetSingleton();
                 nmgr->SetWhooshConfig(nm, filters);
+                if (Feedback::NotifyIfMoveBusy()) return;
 
                 auto moved = Distributor::Whoosh(nm);
                 if (moved > 0) {
@@ -579,6 +608,7 @@ namespace SLIDMenu {
                 CatchAllPanel::Destroy();
                 OriginPanel::Destroy();
                 ActionBar::Destroy();
+                g_predictionSession.reset();
                 g_activeMenu = nullptr;
                 return RE::UI_MESSAGE_RESULTS::kHandled;
 
@@ -605,6 +635,9 @@ namespace SLIDMenu {
             ConfigState::SetContext(a_networkName, net ? net->masterFormID : 0);
         }
 
+        // Followers may have been recruited or dismissed since the last open
+        ContainerRegistry::GetSingleton()->InvalidateOwnership();
+
         // Request SCIE containers for picker (async — response cached for session)
         if (Settings::bSCIEIncludeContainers && SCIEIntegration::IsInstalled()) {
             SCIEIntegration::RequestContainers();
@@ -1041,7 +1074,12 @@ namespace SLIDMenu {
                                      .defaultIndex = 2},
                                     [networkName, doReset](int idx) {
                                         if (idx == 0) {
-                                            // Pull items to master, then reset
+                                            // Pull items to master, then reset — not while
+                                            // a Sort is still placing them
+                                            if (Feedback::NotifyIfMoveBusy()) {
+                                                InputHandler::ResetRepeat();
+                                                return;
+                                            }
                                             logger::info("Defaults: pulling items to master before reset");
                                             Distributor::GatherToMaster(networkName);
                                             doReset();
@@ -1104,6 +1142,11 @@ namespace SLIDMenu {
         if (Dropdown::IsAnyOpen()) {
             auto* dd = Dropdown::GetOpen();
             for (auto* event = *a_event; event; event = event->next) {
+                // Type-ahead search (searchable pickers enable CharEvents while open)
+                if (event->GetEventType() == RE::INPUT_EVENT_TYPE::kChar) {
+                    dd->AppendSearchChar(static_cast<RE::CharEvent*>(event)->keycode);
+                    continue;
+                }
                 if (event->eventType == RE::INPUT_EVENT_TYPE::kThumbstick) {
                     auto* ts = static_cast<RE::ThumbstickEvent*>(event);
                     if (!ts->IsLeft()) continue;
@@ -1127,6 +1170,10 @@ namespace SLIDMenu {
                 if (!button->IsDown()) continue;
                 if (p.confirm)     dd->Confirm();
                 else if (p.cancel) dd->Cancel();
+                else if (event->GetDevice() == RE::INPUT_DEVICE::kKeyboard &&
+                         button->GetIDCode() == RE::BSKeyboardDevice::Key::kBackspace) {
+                    dd->EraseSearchChar();
+                }
             }
             return RE::BSEventNotifyControl::kContinue;
         }
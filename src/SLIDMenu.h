@@ -3,6 +3,10 @@
 #include "DirectionalInput.h"
 #include "ScaleformUtil.h"
 
+namespace Distributor {
+    struct DistributeResult;
+}
+
 namespace SLIDMenu {
     // Menu name used for registration and lookup
     constexpr std::string_view MENU_NAME = "SLIDConfigMenu";
@@ -57,6 +61,9 @@ namespace SLIDMenu {
 
         // Pipeline operations
         void RunSort();
+        void FinishSort(const Distributor::DistributeResult& a_result,
+                        const std::vector<int>& a_oldFilterCounts,
+                        int a_oldCatchAllCount, int a_oldOriginCount);
         void RunSweep();
         void RunWhoosh();
         void RecalcPredictions();
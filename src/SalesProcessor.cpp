@@ -21,9 +21,15 @@ namespace SalesProcessor {
             if (result.itemsSold > 0) {
                 mgr->AppendTransactions(result.transactions);
 
-                std::string msg = TF("$SLID_NotifySold",
-                                     std::to_string(result.itemsSold),
-                                     std::to_string(result.goldEarned));
+                // Catch-up after a long wait: one summary for every owed interval
+                std::string msg = result.intervals > 1
+                    ? TF("$SLID_NotifySoldCatchUp",
+                         std::to_string(result.itemsSold),
+                         std::to_string(result.goldEarned),
+                         std::to_string(result.intervals))
+                    : TF("$SLID_NotifySold",
+                         std::to_string(result.itemsSold),
+                         std::to_string(result.goldEarned));
                 RE::DebugNotification(msg.c_str());
                 logger::info("SalesProcessor: {}", msg);
                 anySold = true;
@@ -36,10 +42,16 @@ namespace SalesProcessor {
 
                 // Use vendor count as the vendor "name" for the notification
                 std::string vendorCount = std::to_string(vendorResult.vendorsVisited) + " vendor(s)";
-                std::string vmsg = TF("$SLID_NotifyVendorSold",
-                                      vendorCount,
-                                      std::to_string(vendorResult.totalItemsSold),
-                                      std::to_string(vendorResult.totalGoldEarned));
+                bool caughtUp = vendorResult.visits > static_cast<uint32_t>(vendorResult.vendorsVisited);
+                std::string vmsg = caughtUp
+                    ? TF("$SLID_NotifyVendorSoldCatchUp",
+                         std::to_string(vendorResult.visits),
+                         std::to_string(vendorResult.totalItemsSold),
+                         std::to_string(vendorResult.totalGoldEarned))
+                    : TF("$SLID_NotifyVendorSold",
+                         vendorCount,
+                         std::to_string(vendorResult.totalItemsSold),
+                         std::to_string(vendorResult.totalGoldEarned));
                 RE::DebugNotification(vmsg.c_str());
                 logger::info("SalesProcessor: {}", vmsg);
                 anySold = true;
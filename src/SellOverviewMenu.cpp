@@ -1,4 +1,5 @@
 #include "SellOverviewMenu.h"
+#include "InventoryCache.h"
 #include "MouseGlow.h"
 #include "NetworkManager.h"
 #include "SalesProcessor.h"
@@ -153,7 +154,7 @@ namespace SellOverview {
         m_vendorCursorIdx = -1;
         m_highlightVendorName.clear();
         m_vendorFlashFrames = 0;
-        m_lastLogSize = NetworkManager::GetSingleton()->GetTransactionLog().size();
+        m_lastLogSize = NetworkManager::GetSingleton()->GetTransactionLog().Size();
         m_menuOpenTime = std::chrono::steady_clock::now();
         if (auto* cal = RE::Calendar::GetSingleton()) {
             m_gameHoursAtOpen = cal->GetHoursPassed();
@@ -259,16 +260,17 @@ namespace SellOverview {
         auto* mgr = NetworkManager::GetSingleton();
         const auto& log = mgr->GetTransactionLog();
 
-        for (size_t i = 0; i < log.size(); ) {
+        for (size_t i = 0; i < log.Size(); ) {
             TransactionRun run;
-            run.vendorName = log[i].vendorName;
-            run.vendorAssortment = log[i].vendorAssortment;
+            uint16_t vendorID = log[i].vendorID;
+            run.vendorName = log.GetString(vendorID);
+            run.vendorAssortment = log.GetString(log[i].assortmentID);
             run.gameTime = log[i].gameTime;
             run.totalItems = 0;
             run.totalGold = 0;
 
-            while (i < log.size() && log[i].gameTime == run.gameTime &&
-                   log[i].vendorName == run.vendorName) {
+            while (i < log.Size() && log[i].gameTime == run.gameTime &&
+                   log[i].vendorID == vendorID) {
                 run.items.push_back(&log[i]);
                 run.totalItems += log[i].quantity;
                 run.totalGold += log[i].goldEarned;
@@ -586,14 +588,9 @@ namespace SellOverview {
         // Count items in sell container
         int pendingItems = 0;
         if (state.formID != 0) {
-            auto* sellRef = RE::TESForm::LookupByID<RE::TESObjectREFR>(state.formID);
-            if (sellRef) {
-                auto inv = sellRef->GetInventory();
-                for (auto& [item, data] : inv) {
-                    if (!item || data.first <= 0 || IsPhantomItem(item)) continue;
-                    if (!item->IsGold()) {
-                        pendingItems += data.first;
-                    }
+            for (const auto& [item, count] : *InventoryCache::Get(state.formID)) {
+                if (!item->IsGold()) {
+                    pendingItems += count;
                 }
             }
         }
@@ -613,6 +610,46 @@ namespace SellOverview {
         std::string contractCount = std::to_string(vendorReg->GetActiveCount());
         ScaleformUtil::CreateLabel(uiMovie.get(), "_statVal4", 27, statsX + 430.0, row2Y, 100.0, 20.0,
                     contractCount.c_str(), 13, COLOR_STAT_VALUE);
+
+        // Rows 3-4: whole-save aggregates, maintained as sales happen
+        const auto& stats = mgr->GetSalesStats();
+        double row3Y = statsY + 48.0;
+        double row4Y = statsY + 72.0;
+
+        std::string avgLabel = T("$SLID_AvgPricePerUnit");
+        ScaleformUtil::CreateLabel(uiMovie.get(), "_statLabel5", 11, statsX, row3Y, 150.0, 20.0,
+                    avgLabel.c_str(), 13, COLOR_STAT_LABEL);
+        char avgPrice[32];
+        std::snprintf(avgPrice, sizeof(avgPrice), "%.2fg", stats.total.AveragePrice());
+        ScaleformUtil::CreateLabel(uiMovie.get(), "_statVal5", 12, statsX + 150.0, row3Y, 100.0, 20.0,
+                    avgPrice, 13, COLOR_STAT_VALUE);
+
+        std::string topBuyerLabel = T("$SLID_TopBuyer");
+        ScaleformUtil::CreateLabel(uiMovie.get(), "_statLabel6", 13, statsX + 280.0, row3Y, 150.0, 20.0,
+                    topBuyerLabel.c_str(), 13, COLOR_STAT_LABEL);
+        std::string topBuyer = stats.topVendor.empty() ? "-" : stats.topVendor;
+        if (topBuyer.size() > 18) topBuyer = topBuyer.substr(0, 16) + "..";
+        ScaleformUtil::CreateLabel(uiMovie.get(), "_statVal6", 14, statsX + 430.0, row3Y, 140.0, 20.0,
+                    topBuyer.c_str(), 13, COLOR_STAT_VALUE);
+
+        uint32_t today = 0;
+        if (auto* calendar = RE::Calendar::GetSingleton()) {
+            today = SalesStats::DayOf(calendar->GetHoursPassed());
+        }
+        std::string recentLabel = T("$SLID_GoldLast7Days");
+        ScaleformUtil::CreateLabel(uiMovie.get(), "_statLabel7", 15, statsX, row4Y, 150.0, 20.0,
+                    recentLabel.c_str(), 13, COLOR_STAT_LABEL);
+        std::string recentGold = std::to_string(stats.GoldOverDays(today, 7));
+        ScaleformUtil::CreateLabel(uiMovie.get(), "_statVal7", 16, statsX + 150.0, row4Y, 100.0, 20.0,
+                    recentGold.c_str(), 13, COLOR_STAT_VALUE);
+
+        std::string bestDayLabel = T("$SLID_BestDay");
+        ScaleformUtil::CreateLabel(uiMovie.get(), "_statLabel8", 17, statsX + 280.0, row4Y, 150.0, 20.0,
+                    bestDayLabel.c_str(), 13, COLOR_STAT_LABEL);
+        auto best = stats.byDay.find(stats.bestDay);
+        std::string bestDayGold = std::to_string(best != stats.byDay.end() ? best->second.gold : 0);
+        ScaleformUtil::CreateLabel(uiMovie.get(), "_statVal8", 18, statsX + 430.0, row4Y, 100.0, 20.0,
+                    bestDayGold.c_str(), 13, COLOR_STAT_VALUE);
     }
 
     void Menu::DrawVendorSchedule() {
@@ -855,7 +892,7 @@ namespace SellOverview {
             SalesProcessor::TryProcessSales();
 
             // Rebuild UI with new transactions
-            m_lastLogSize = NetworkManager::GetSingleton()->GetTransactionLog().size();
+            m_lastLogSize = NetworkManager::GetSingleton()->GetTransactionLog().Size();
             BuildRuns();
             BuildVendorEntries();
             DrawPopup();
@@ -1044,10 +1081,11 @@ namespace SellOverview {
                 ScaleformUtil::CreateLabel(uiMovie.get(), (prefix + "Vendor").c_str(), baseDepth + 4,
                             logX, curY, 1.0, 1.0, "", 10, 0x000000);
 
-                // Item
+                // Item (resolved from FormID at display time)
+                std::string itemName = NetworkManager::GetSingleton()->GetTransactionLog().GetItemName(*tx);
                 ScaleformUtil::CreateLabel(uiMovie.get(), (prefix + "Item").c_str(), baseDepth + 5,
                             logX + LOG_COL_ITEM_X, curY, LOG_COL_ITEM_W, rh,
-                            tx->itemName.c_str(), 10, detailColor);
+                            itemName.c_str(), 10, detailColor);
 
                 // Qty (right-aligned)
                 std::string qtyText = std::to_string(tx->quantity);
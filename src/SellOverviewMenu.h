@@ -16,7 +16,7 @@ namespace SellOverview {
 
     // Stats area
     constexpr double STATS_Y = 60.0;       // Y offset within popup
-    constexpr double STATS_H = 52.0;
+    constexpr double STATS_H = 100.0;      // 4 rows: totals, pending, averages, recent
 
     // Vendor schedule section (between stats and log)
     constexpr double VENDOR_SCHED_Y = STATS_Y + STATS_H + 4.0;
@@ -110,7 +110,7 @@ namespace SellOverview {
         float       gameTime = 0.0f;
         int32_t     totalItems = 0;
         int32_t     totalGold = 0;
-        std::vector<const SaleTransaction*> items;
+        std::vector<const SaleRecord*> items;
         bool        expanded = false;
     };
 
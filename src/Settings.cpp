@@ -194,6 +194,12 @@ namespace Settings {
                 } else if (key == "bInterceptActivation") {
                     bInterceptActivation = ParseBool(val, bInterceptActivation); matched = true;
                 }
+            } else if (currentSection == "Sort") {
+                if (key == "bDeltaSort") {
+                    bDeltaSort = ParseBool(val, bDeltaSort); matched = true;
+                } else if (key == "fSortFrameBudgetMs") {
+                    fSortFrameBudgetMs = std::max(0.5f, ParseFloat(val, fSortFrameBudgetMs)); matched = true;
+                }
             } else if (currentSection == "Powers") {
                 if (key == "bSummonEnabled") {
                     bSummonEnabled = ParseBool(val, bSummonEnabled); matched = true;
@@ -222,6 +228,8 @@ namespace Settings {
                 if (key == "fSellPricePercent")       { fSellPricePercent  = ParseFloat(val, fSellPricePercent); matched = true; }
                 else if (key == "iSellBatchSize")     { iSellBatchSize     = ParseInt(val, iSellBatchSize); matched = true; }
                 else if (key == "fSellIntervalHours") { fSellIntervalHours = ParseFloat(val, fSellIntervalHours); matched = true; }
+                else if (key == "iMaxCatchUpIntervals") { iMaxCatchUpIntervals = std::max(1, ParseInt(val, iMaxCatchUpIntervals)); matched = true; }
+                else if (key == "iTransactionLogSize")  { iTransactionLogSize  = std::clamp(ParseInt(val, iTransactionLogSize), 100, 50000); matched = true; }
             } else if (currentSection == "VendorSales") {
                 if (key == "fVendorPricePercent")       { fVendorPricePercent  = ParseFloat(val, fVendorPricePercent); matched = true; }
                 else if (key == "iVendorBatchSize")     { iVendorBatchSize     = ParseInt(val, iVendorBatchSize); matched = true; }
@@ -0,0 +1,208 @@
+#include "TraitCache.h"
+#include "TraitEvaluator.h"
+
+#include <bit>
+#include <mutex>
+#include <unordered_map>
+
+namespace TraitCache {
+
+    namespace {
+        // Per-item memo: known[w] marks evaluated traits, value[w] holds their results
+        struct Entry {
+            uint32_t generation = 0;
+            std::vector<uint64_t> known;
+            std::vector<uint64_t> value;
+        };
+
+        std::mutex s_lock;
+
+        // Interned trait table — index = bit position
+        std::vector<TraitEvaluator::CompiledTrait> s_traits;
+        std::unordered_map<std::string, size_t> s_traitIndex;
+        Mask s_volatileMask;
+
+        std::unordered_map<RE::FormID, Entry> s_entries;
+        uint32_t s_generation = 1;
+
+        size_t WordCount() {
+            return (s_traits.size() + 63) / 64;
+        }
+
+        bool IsDynamicFormID(RE::FormID a_formID) {
+            return (a_formID >> 24) == 0xFF;
+        }
+
+        // Caller must hold s_lock
+        size_t InternUnsafe(const std::string& a_trait) {
+            auto it = s_traitIndex.find(a_trait);
+            if (it != s_traitIndex.end()) return it->second;
+
+            size_t index = s_traits.size();
+            s_traits.push_back(TraitEvaluator::Compile(a_trait));
+            s_traitIndex.emplace(a_trait, index);
+
+            s_volatileMask.resize(WordCount(), 0);
+            if (TraitEvaluator::IsVolatile(s_traits.back().op)) {
+                s_volatileMask[index / 64] |= 1ull << (index % 64);
+            }
+            return index;
+        }
+
+        // Caller must hold s_lock
+        Mask MakeMaskUnsafe(const std::vector<std::string>& a_traits) {
+            Mask mask;
+            for (const auto& trait : a_traits) {
+                size_t index = InternUnsafe(trait);
+                if (mask.size() <= index / 64) mask.resize(index / 64 + 1, 0);
+                mask[index / 64] |= 1ull << (index % 64);
+            }
+            return mask;
+        }
+
+        // Caller must hold s_lock
+        Entry& GetEntryUnsafe(RE::TESBoundObject* a_item) {
+            auto formID = a_item->GetFormID();
+            auto& entry = s_entries[formID];
+
+            size_t words = WordCount();
+            if (entry.known.size() < words) {
+                entry.known.resize(words, 0);
+                entry.value.resize(words, 0);
+            }
+
+            if (entry.generation != s_generation) {
+                if (IsDynamicFormID(formID)) {
+                    std::fill(entry.known.begin(), entry.known.end(), 0);
+                } else {
+                    for (size_t w = 0; w < s_volatileMask.size(); ++w) {
+                        entry.known[w] &= ~s_volatileMask[w];
+                    }
+                }
+                entry.generation = s_generation;
+            }
+            return entry;
+        }
+
+        // Evaluate every bit of a_bits (within word a_word) that is not yet known
+        void EnsureWord(Entry& a_entry, size_t a_word, uint64_t a_bits, RE::TESBoundObject* a_item) {
+            uint64_t missing = a_bits & ~a_entry.known[a_word];
+            while (missing) {
+                int bit = std::countr_zero(missing);
+                missing &= missing - 1;
+                uint64_t flag = 1ull << bit;
+                if (TraitEvaluator::Evaluate(s_traits[a_word * 64 + bit], a_item)) {
+                    a_entry.value[a_word] |= flag;
+                }
+                a_entry.known[a_word] |= flag;
+            }
+        }
+    }
+
+    void Build(const std::vector<std::string>& a_traits) {
+        std::lock_guard lock(s_lock);
+        s_traits.clear();
+        s_traitIndex.clear();
+        s_volatileMask.clear();
+        s_entries.clear();
+        if (++s_generation == 0) s_generation = 1;
+
+        for (const auto& trait : a_traits) {
+            InternUnsafe(trait);
+        }
+
+        size_t volatileCount = 0;
+        for (auto word : s_volatileMask) volatileCount += std::popcount(word);
+        logger::info("TraitCache: interned {} traits ({} volatile)", s_traits.size(), volatileCount);
+    }
+
+    Program Compile(const std::vector<std::string>& a_require,
+                    const std::vector<std::string>& a_exclude,
+                    const std::vector<std::string>& a_requireAny) {
+        std::lock_guard lock(s_lock);
+        Program program;
+        program.require = MakeMaskUnsafe(a_require);
+        program.exclude = MakeMaskUnsafe(a_exclude);
+        program.requireAny = MakeMaskUnsafe(a_requireAny);
+        return program;
+    }
+
+    bool IsVolatile(const Program& a_program) {
+        std::lock_guard lock(s_lock);
+        for (const auto* mask : {&a_program.require, &a_program.exclude, &a_program.requireAny}) {
+            for (size_t w = 0; w < mask->size() && w < s_volatileMask.size(); ++w) {
+                if ((*mask)[w] & s_volatileMask[w]) return true;
+            }
+        }
+        return false;
+    }
+
+    bool Matches(const Program& a_program, RE::TESBoundObject* a_item) {
+        if (!a_item) return false;
+
+        std::lock_guard lock(s_lock);
+        auto& entry = GetEntryUnsafe(a_item);
+
+        // RequireTrait — all must pass. Known bits first, then evaluate the rest.
+        for (size_t w = 0; w < a_program.require.size(); ++w) {
+            uint64_t bits = a_program.require[w];
+            if (!bits) continue;
+            uint64_t knownBits = bits & entry.known[w];
+            if ((entry.value[w] & knownBits) != knownBits) return false;
+            EnsureWord(entry, w, bits, a_item);
+            if ((entry.value[w] & bits) != bits) return false;
+        }
+
+        // ExcludeTrait — none must pass
+        for (size_t w = 0; w < a_program.exclude.size(); ++w) {
+            uint64_t bits = a_program.exclude[w];
+            if (!bits) continue;
+            if (entry.value[w] & bits & entry.known[w]) return false;
+            EnsureWord(entry, w, bits, a_item);
+            if (entry.value[w] & bits) return false;
+        }
+
+        // RequireAnyTrait — at least one must pass (if non-empty)
+        if (!a_program.requireAny.empty()) {
+            for (size_t w = 0; w < a_program.requireAny.size(); ++w) {
+                uint64_t bits = a_program.requireAny[w];
+                if (entry.value[w] & bits & entry.known[w]) return true;
+            }
+            for (size_t w = 0; w < a_program.requireAny.size(); ++w) {
+                uint64_t bits = a_program.requireAny[w];
+                if (!bits) continue;
+                EnsureWord(entry, w, bits, a_item);
+                if (entry.value[w] & bits) return true;
+            }
+            return false;
+        }
+
+        return true;
+    }
+
+    void InvalidateVolatile() {
+        std::lock_guard lock(s_lock);
+        if (++s_generation == 0) s_generation = 1;
+    }
+
+    void Clear() {
+        std::lock_guard lock(s_lock);
+        s_entries.clear();
+        if (++s_generation == 0) s_generation = 1;
+    }
+
+    uint32_t GetGeneration() {
+        std::lock_guard lock(s_lock);
+        return s_generation;
+    }
+
+    size_t GetTraitCount() {
+        std::lock_guard lock(s_lock);
+        return s_traits.size();
+    }
+
+    size_t GetEntryCount() {
+        std::lock_guard lock(s_lock);
+        return s_entries.size();
+    }
+}
@@ -3,7 +3,6 @@
 #include "Distributor.h"
 #include "FilterRegistry.h"
 
-#include <functional>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -66,7 +65,7 @@ namespace TraitEvaluator {
     };
 
     // -----------------------------------------------------------------------
-    // FormList cache — resolved lazily, used by formlist: traits
+    // FormList cache — resolved at compile time, used by formlist: traits
     // -----------------------------------------------------------------------
 
     struct FormListEntry {
@@ -76,15 +75,18 @@ namespace TraitEvaluator {
 
     static std::unordered_map<std::string, FormListEntry> s_formListCache;
 
+    // MagicDisallowEnchanting — resolved at Init(), used by unknown_enchantment
+    static RE::BGSKeyword* s_disallowEnchanting = nullptr;
+
     // -----------------------------------------------------------------------
-    // Handler: formlist:EditorID@Plugin.esp
+    // Compiler: formlist:EditorID@Plugin.esp
     // -----------------------------------------------------------------------
 
-    static bool EvalFormList(const std::string& suffix, RE::TESBoundObject* item) {
+    static RE::BGSListForm* ResolveFormList(const std::string& suffix) {
         // Check cache first
         auto it = s_formListCache.find(suffix);
         if (it != s_formListCache.end()) {
-            return it->second.list && it->second.list->HasForm(item);
+            return it->second.list;
         }
 
         // Parse EditorID@PluginName
@@ -92,7 +94,7 @@ namespace TraitEvaluator {
         if (atPos == std::string::npos || atPos == 0 || atPos == suffix.size() - 1) {
             logger::warn("TraitEvaluator: formlist trait '{}' must use format EditorID@Plugin.esp", suffix);
             s_formListCache[suffix] = {nullptr, true};
-            return false;
+            return nullptr;
         }
 
         auto editorID  = suffix.substr(0, atPos);
@@ -103,7 +105,7 @@ namespace TraitEvaluator {
         if (!dh || !dh->LookupModByName(pluginName)) {
             logger::debug("TraitEvaluator: formlist plugin '{}' not loaded, caching as null", pluginName);
             s_formListCache[suffix] = {nullptr, true};
-            return false;
+            return nullptr;
         }
 
         // Resolve FormList by EditorID
@@ -114,67 +116,86 @@ namespace TraitEvaluator {
             logger::info("TraitEvaluator: cached formlist '{}' ({} forms)", suffix, list->forms.size());
         }
         s_formListCache[suffix] = {list, true};
-        return list && list->HasForm(item);
+        return list;
+    }
+
+    static bool CompileFormList(const std::string& suffix, CompiledTrait& out) {
+        out.op = Op::kFormList;
+        out.formList = ResolveFormList(suffix);
+        return true;
     }
 
     // -----------------------------------------------------------------------
-    // Handler: formtype:X
+    // Compiler: formtype:X
     // -----------------------------------------------------------------------
 
-    static bool EvalFormType(const std::string& suffix, RE::TESBoundObject* item) {
+    static bool CompileFormType(const std::string& suffix, CompiledTrait& out) {
         auto it = s_formTypeMap.find(suffix);
         if (it == s_formTypeMap.end()) {
             logger::warn("TraitEvaluator: unknown formtype '{}'", suffix);
             return false;
         }
-        return item->GetFormType() == it->second;
+        out.op = Op::kFormType;
+        out.formType = it->second;
+        return true;
     }
 
     // -----------------------------------------------------------------------
-    // Handler: keyword:EditorID
+    // Compiler: keyword:EditorID
     // -----------------------------------------------------------------------
 
-    static bool EvalKeyword(const std::string& suffix, RE::TESBoundObject* item) {
-        auto* kwForm = item->As<RE::BGSKeywordForm>();
-        if (!kwForm) return false;
+    static bool CompileKeyword(const std::string& suffix, CompiledTrait& out) {
+        // ESP keywords match by pointer. KID/OCF add existing ESP keywords by
+        // the same pointer, so only keywords with no ESP record need the
+        // string-based match (dynamically created at runtime).
+        RE::BGSKeyword* kw = nullptr;
+        auto it = s_keywordCache.find(suffix);
+        if (it != s_keywordCache.end()) {
+            kw = it->second;
+        } else {
+            kw = RE::TESForm::LookupByEditorID<RE::BGSKeyword>(suffix);
+        }
 
-        // String-based match — works with ESP keywords AND dynamically created
-        // keywords (e.g. from Keyword Item Distributor / OCF)
-        return kwForm->HasKeywordString(suffix);
+        if (kw) {
+            out.op = Op::kKeyword;
+            out.keyword = kw;
+        } else {
+            out.op = Op::kKeywordString;
+            out.suffixPos = out.text.size() - suffix.size();
+        }
+        return true;
     }
 
     // -----------------------------------------------------------------------
-    // Handler: weapon_type:X
+    // Compiler: weapon_type:X
     // -----------------------------------------------------------------------
 
-    static bool EvalWeaponType(const std::string& suffix, RE::TESBoundObject* item) {
-        if (item->GetFormType() != RE::FormType::Weapon) return false;
-        auto* weapon = item->As<RE::TESObjectWEAP>();
-        if (!weapon) return false;
+    static bool CompileWeaponType(const std::string& suffix, CompiledTrait& out) {
         auto it = s_weaponTypeMap.find(suffix);
         if (it == s_weaponTypeMap.end()) {
             logger::warn("TraitEvaluator: unknown weapon_type '{}'", suffix);
             return false;
         }
-        return weapon->GetWeaponType() == it->second;
+        out.op = Op::kWeaponType;
+        out.weaponType = it->second;
+        return true;
     }
 
     // -----------------------------------------------------------------------
-    // Handler: slot:X (head, body, hands, feet, ring, amulet, circlet, shield, or 30-61)
+    // Compiler: slot:X (head, body, hands, feet, ring, amulet, circlet, shield, or 30-61)
     // -----------------------------------------------------------------------
 
-    static bool EvalSlot(const std::string& suffix, RE::TESBoundObject* item) {
-        if (item->GetFormType() != RE::FormType::Armor) return false;
-        auto* armor = item->As<RE::TESObjectARMO>();
-        if (!armor) return false;
-
+    static bool CompileSlot(const std::string& suffix, CompiledTrait& out) {
         if (suffix == "shield") {
-            return armor->IsShield();
+            out.op = Op::kShield;
+            return true;
         }
 
         auto it = s_slotMap.find(suffix);
         if (it != s_slotMap.end()) {
-            return armor->HasPartOf(it->second);
+            out.op = Op::kSlot;
+            out.slotMask = it->second;
+            return true;
         }
 
         // Numeric slot fallback: game slots 30–61 → bit (N-30)
@@ -184,8 +205,9 @@ namespace TraitEvaluator {
                 logger::warn("TraitEvaluator: slot '{}' out of range (30-61)", suffix);
                 return false;
             }
-            auto mask = static_cast<Slot>(1u << (slot - 30));
-            return armor->HasPartOf(mask);
+            out.op = Op::kSlot;
+            out.slotMask = static_cast<Slot>(1u << (slot - 30));
+            return true;
         } catch (...) {
             logger::warn("TraitEvaluator: unknown slot '{}'", suffix);
             return false;
@@ -193,60 +215,56 @@ namespace TraitEvaluator {
     }
 
     // -----------------------------------------------------------------------
-    // Handler: armor_weight:X (light, heavy, clothing)
+    // Compiler: armor_weight:X (light, heavy, clothing)
     // -----------------------------------------------------------------------
 
-    static bool EvalArmorWeight(const std::string& suffix, RE::TESBoundObject* item) {
-        if (item->GetFormType() != RE::FormType::Armor) return false;
-        auto* armor = item->As<RE::TESObjectARMO>();
-        if (!armor) return false;
-
-        if (suffix == "light")    return armor->IsLightArmor();
-        if (suffix == "heavy")    return armor->IsHeavyArmor();
-        if (suffix == "clothing") return armor->IsClothing();
+    static bool CompileArmorWeight(const std::string& suffix, CompiledTrait& out) {
+        if (suffix == "light")    { out.op = Op::kArmorLight;    return true; }
+        if (suffix == "heavy")    { out.op = Op::kArmorHeavy;    return true; }
+        if (suffix == "clothing") { out.op = Op::kArmorClothing; return true; }
 
         logger::warn("TraitEvaluator: unknown armor_weight '{}'", suffix);
         return false;
     }
 
     // -----------------------------------------------------------------------
-    // Handler: cobj_output:X / cobj_input:X
+    // Compiler: cobj_output:X / cobj_input:X
     // -----------------------------------------------------------------------
 
-    static bool EvalCOBJOutput(const std::string& suffix, RE::TESBoundObject* item) {
-        auto& cobj = Distributor::GetCOBJSets();
-        if (suffix == "CraftingCookpot")     return cobj.cookedFood.count(item->GetFormID()) > 0;
-        if (suffix == "CraftingTanningRack") return cobj.tanningOutputs.count(item->GetFormID()) > 0;
+    static bool CompileCOBJOutput(const std::string& suffix, CompiledTrait& out) {
+        if (suffix == "CraftingCookpot")     { out.op = Op::kCookedFood;    return true; }
+        if (suffix == "CraftingTanningRack") { out.op = Op::kTanningOutput; return true; }
         logger::warn("TraitEvaluator: unknown cobj_output bench '{}'", suffix);
         return false;
     }
 
-    static bool EvalCOBJInput(const std::string& suffix, RE::TESBoundObject* item) {
-        auto& cobj = Distributor::GetCOBJSets();
-        if (suffix == "CraftingSmelter")    return cobj.smeltableInputs.count(item->GetFormID()) > 0;
-        if (suffix == "BYOHCarpenterTable") return cobj.hearthfireMats.count(item->GetFormID()) > 0;
+    static bool CompileCOBJInput(const std::string& suffix, CompiledTrait& out) {
+        if (suffix == "CraftingSmelter")    { out.op = Op::kSmeltableInput; return true; }
+        if (suffix == "BYOHCarpenterTable") { out.op = Op::kHearthfireMat;  return true; }
         logger::warn("TraitEvaluator: unknown cobj_input bench '{}'", suffix);
         return false;
     }
 
     // -----------------------------------------------------------------------
-    // Handler: in_pool:X / in_group:X
+    // Compiler: in_pool:X / in_group:X
     // -----------------------------------------------------------------------
 
-    static bool EvalInPool(const std::string& suffix, RE::TESBoundObject* item) {
+    static bool CompileInPool(const std::string& suffix, CompiledTrait& out) {
         if (suffix == "unique_items") {
-            return Settings::uniqueItemFormIDs.count(item->GetFormID()) > 0;
+            out.op = Op::kFormIDSet;
+            out.formIDs = &Settings::uniqueItemFormIDs;
+            return true;
         }
         logger::warn("TraitEvaluator: unknown pool '{}'", suffix);
         return false;
     }
 
-    static bool EvalInGroup(const std::string& suffix, RE::TESBoundObject* item) {
+    static bool CompileInGroup(const std::string& suffix, CompiledTrait& out) {
+        // Group not loaded = not matching, not an error
+        out.op = Op::kFormIDSet;
         auto it = Settings::uniqueItemGroups.find(suffix);
-        if (it != Settings::uniqueItemGroups.end()) {
-            return it->second.count(item->GetFormID()) > 0;
-        }
-        return false;  // group not loaded = not matching, not an error
+        out.formIDs = (it != Settings::uniqueItemGroups.end()) ? &it->second : nullptr;
+        return true;
     }
 
     // -----------------------------------------------------------------------
@@ -302,13 +320,9 @@ namespace TraitEvaluator {
         if (!enchantable || !enchantable->formEnchanting) return false;
 
         // MagicDisallowEnchanting keyword = item cannot be disenchanted
-        auto* kwForm = item->As<RE::BGSKeywordForm>();
-        if (kwForm) {
-            auto* dh = RE::TESDataHandler::GetSingleton();
-            if (dh) {
-                auto* kw = dh->LookupForm<RE::BGSKeyword>(Settings::uMagicDisallowEnchanting, Settings::sKeywordPlugin);
-                if (kw && kwForm->HasKeyword(kw)) return false;
-            }
+        if (s_disallowEnchanting) {
+            auto* kwForm = item->As<RE::BGSKeywordForm>();
+            if (kwForm && kwForm->HasKeyword(s_disallowEnchanting)) return false;
         }
 
         auto* ench = enchantable->formEnchanting;
@@ -326,11 +340,10 @@ namespace TraitEvaluator {
     // Dispatch table
     // -----------------------------------------------------------------------
 
-    using PrefixHandler = std::function<bool(const std::string& suffix, RE::TESBoundObject* item)>;
-    using WholeHandler  = std::function<bool(RE::TESBoundObject* item)>;
+    using PrefixCompiler = bool (*)(const std::string& suffix, CompiledTrait& out);
 
-    static std::unordered_map<std::string, PrefixHandler> s_prefixHandlers;
-    static std::unordered_map<std::string, WholeHandler>  s_wholeHandlers;
+    static std::unordered_map<std::string, PrefixCompiler> s_prefixHandlers;
+    static std::unordered_map<std::string, Op>             s_wholeHandlers;
     static std::unordered_set<std::string> s_warnedUnknown;
 
     // -----------------------------------------------------------------------
@@ -357,45 +370,49 @@ namespace TraitEvaluator {
             resolve("VendorItemKey",        Settings::uVendorItemKey);
             resolve("MagicDisallowEnchanting", Settings::uMagicDisallowEnchanting);
         }
+        auto disallowIt = s_keywordCache.find("MagicDisallowEnchanting");
+        s_disallowEnchanting = disallowIt != s_keywordCache.end() ? disallowIt->second : nullptr;
 
         // Build prefix dispatch table
-        s_prefixHandlers["formtype"]     = EvalFormType;
-        s_prefixHandlers["keyword"]      = EvalKeyword;
-        s_prefixHandlers["weapon_type"]  = EvalWeaponType;
-        s_prefixHandlers["slot"]         = EvalSlot;
-        s_prefixHandlers["armor_weight"] = EvalArmorWeight;
-        s_prefixHandlers["cobj_output"]  = EvalCOBJOutput;
-        s_prefixHandlers["cobj_input"]   = EvalCOBJInput;
-        s_prefixHandlers["in_pool"]      = EvalInPool;
-        s_prefixHandlers["in_group"]     = EvalInGroup;
-        s_prefixHandlers["formlist"]     = EvalFormList;
+        s_prefixHandlers["formtype"]     = CompileFormType;
+        s_prefixHandlers["keyword"]      = CompileKeyword;
+        s_prefixHandlers["weapon_type"]  = CompileWeaponType;
+        s_prefixHandlers["slot"]         = CompileSlot;
+        s_prefixHandlers["armor_weight"] = CompileArmorWeight;
+        s_prefixHandlers["cobj_output"]  = CompileCOBJOutput;
+        s_prefixHandlers["cobj_input"]   = CompileCOBJInput;
+        s_prefixHandlers["in_pool"]      = CompileInPool;
+        s_prefixHandlers["in_group"]     = CompileInGroup;
+        s_prefixHandlers["formlist"]     = CompileFormList;
 
         // Build whole-name dispatch table (engine method traits)
-        s_wholeHandlers["is_food"]               = EvalIsFood;
-        s_wholeHandlers["is_poison"]             = EvalIsPoison;
-        s_wholeHandlers["has_enchantment"]       = EvalHasEnchantment;
-        s_wholeHandlers["has_spell"]             = EvalHasSpell;
-        s_wholeHandlers["teaches_skill"]         = EvalTeachesSkill;
-        s_wholeHandlers["is_note"]               = EvalIsNote;
-        s_wholeHandlers["unknown_enchantment"]   = EvalUnknownEnchantment;
-        s_wholeHandlers["unread_book"]            = EvalUnreadBook;
-        s_wholeHandlers["unlearned_spell"]        = EvalUnlearnedSpell;
+        s_wholeHandlers["is_food"]               = Op::kIsFood;
+        s_wholeHandlers["is_poison"]             = Op::kIsPoison;
+        s_wholeHandlers["has_enchantment"]       = Op::kHasEnchantment;
+        s_wholeHandlers["has_spell"]             = Op::kHasSpell;
+        s_wholeHandlers["teaches_skill"]         = Op::kTeachesSkill;
+        s_wholeHandlers["is_note"]               = Op::kIsNote;
+        s_wholeHandlers["unknown_enchantment"]   = Op::kUnknownEnchantment;
+        s_wholeHandlers["unread_book"]           = Op::kUnreadBook;
+        s_wholeHandlers["unlearned_spell"]       = Op::kUnlearnedSpell;
 
         logger::info("TraitEvaluator: initialized ({} keywords cached, {} prefix handlers, {} engine traits)",
             s_keywordCache.size(), s_prefixHandlers.size(), s_wholeHandlers.size());
     }
 
     // -----------------------------------------------------------------------
-    // Evaluate
+    // Compile
     // -----------------------------------------------------------------------
 
-    bool Evaluate(const std::string& traitName, RE::TESBoundObject* item) {
-        if (!item) return false;
+    CompiledTrait Compile(const std::string& traitName) {
+        CompiledTrait result;
+        result.text = traitName;
 
         // Check whole-name handlers first (engine methods)
         auto wholeIt = s_wholeHandlers.find(traitName);
         if (wholeIt != s_wholeHandlers.end()) {
-            return wholeIt->second(item);
+            result.op = wholeIt->second;
+            return result;
         }
 
         // Parse prefix:suffix
@@ -406,7 +423,10 @@ namespace TraitEvaluator {
 
             auto prefixIt = s_prefixHandlers.find(prefix);
             if (prefixIt != s_prefixHandlers.end()) {
-                return prefixIt->second(suffix, item);
+                if (!prefixIt->second(suffix, result)) {
+                    result.op = Op::kNever;  // handler already warned about the suffix
+                }
+                return result;
             }
         }
 
@@ -414,13 +434,103 @@ namespace TraitEvaluator {
         if (s_warnedUnknown.insert(traitName).second) {
             logger::warn("TraitEvaluator: unknown trait '{}'", traitName);
         }
-        return false;
+        result.op = Op::kNever;
+        return result;
+    }
+
+    // -----------------------------------------------------------------------
+    // Evaluate
+    // -----------------------------------------------------------------------
+
+    static RE::TESObjectARMO* AsArmor(RE::TESBoundObject* item) {
+        if (item->GetFormType() != RE::FormType::Armor) return nullptr;
+        return item->As<RE::TESObjectARMO>();
+    }
+
+    bool Evaluate(const CompiledTrait& trait, RE::TESBoundObject* item) {
+        if (!item) return false;
+
+        switch (trait.op) {
+            case Op::kFormType:
+                return item->GetFormType() == trait.formType;
+
+            case Op::kKeyword: {
+                auto* kwForm = item->As<RE::BGSKeywordForm>();
+                return kwForm && kwForm->HasKeyword(trait.keyword);
+            }
+            case Op::kKeywordString: {
+                auto* kwForm = item->As<RE::BGSKeywordForm>();
+                return kwForm && kwForm->HasKeywordString(
+                    std::string_view(trait.text).substr(trait.suffixPos));
+            }
+
+            case Op::kWeaponType: {
+                if (item->GetFormType() != RE::FormType::Weapon) return false;
+                auto* weapon = item->As<RE::TESObjectWEAP>();
+                return weapon && weapon->GetWeaponType() == trait.weaponType;
+            }
+
+            case Op::kSlot: {
+                auto* armor = AsArmor(item);
+                return armor && armor->HasPartOf(trait.slotMask);
+            }
+            case Op::kShield: {
+                auto* armor = AsArmor(item);
+                return armor && armor->IsShield();
+            }
+            case Op::kArmorLight: {
+                auto* armor = AsArmor(item);
+                return armor && armor->IsLightArmor();
+            }
+            case Op::kArmorHeavy: {
+                auto* armor = AsArmor(item);
+                return armor && armor->IsHeavyArmor();
+            }
+            case Op::kArmorClothing: {
+                auto* armor = AsArmor(item);
+                return armor && armor->IsClothing();
+            }
+
+            case Op::kCookedFood:
+                return Distributor::GetCOBJSets().cookedFood.count(item->GetFormID()) > 0;
+            case Op::kTanningOutput:
+                return Distributor::GetCOBJSets().tanningOutputs.count(item->GetFormID()) > 0;
+            case Op::kSmeltableInput:
+                return Distributor::GetCOBJSets().smeltableInputs.count(item->GetFormID()) > 0;
+            case Op::kHearthfireMat:
+                return Distributor::GetCOBJSets().hearthfireMats.count(item->GetFormID()) > 0;
+
+            case Op::kFormIDSet:
+                return trait.formIDs && trait.formIDs->count(item->GetFormID()) > 0;
+            case Op::kFormList:
+                return trait.formList && trait.formList->HasForm(item);
+
+            case Op::kIsFood:             return EvalIsFood(item);
+            case Op::kIsPoison:           return EvalIsPoison(item);
+            case Op::kHasEnchantment:     return EvalHasEnchantment(item);
+            case Op::kHasSpell:           return EvalHasSpell(item);
+            case Op::kTeachesSkill:       return EvalTeachesSkill(item);
+            case Op::kIsNote:             return EvalIsNote(item);
+            case Op::kUnreadBook:         return EvalUnreadBook(item);
+            case Op::kUnlearnedSpell:     return EvalUnlearnedSpell(item);
+            case Op::kUnknownEnchantment: return EvalUnknownEnchantment(item);
+
+            case Op::kNever:
+            default:
+                return false;
+        }
+    }
+
+    bool Evaluate(const std::string& traitName, RE::TESBoundObject* item) {
+        if (!item) return false;
+        return Evaluate(Compile(traitName), item);
     }
 
     void ClearCaches() {
         s_keywordCache.clear();
         s_formListCache.clear();
         s_warnedUnknown.clear();
+        s_disallowEnchanting = nullptr;
     }
 
     uint32_t ValidateKeywords() {
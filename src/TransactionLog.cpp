@@ -0,0 +1,334 @@
+#include "TransactionLog.h"
+
+namespace {
+    bool IsDynamicForm(RE::FormID a_formID) {
+        return a_formID == 0 || (a_formID >> 24) == 0xFF;
+    }
+
+    void WriteString(SKSE::SerializationInterface* a_intfc, const std::string& a_str) {
+        auto len = static_cast<uint16_t>(std::min<size_t>(a_str.size(), UINT16_MAX));
+        a_intfc->WriteRecordData(&len, sizeof(len));
+        a_intfc->WriteRecordData(a_str.data(), len);
+    }
+
+    std::string ReadString(SKSE::SerializationInterface* a_intfc) {
+        uint16_t len = 0;
+        a_intfc->ReadRecordData(&len, sizeof(len));
+        std::string str(len, '\0');
+        a_intfc->ReadRecordData(str.data(), len);
+        return str;
+    }
+}
+
+void TransactionLog::SetCapacity(size_t a_capacity) {
+    a_capacity = std::clamp(a_capacity, kMinCapacity, kMaxCapacity);
+    if (a_capacity == m_records.size()) return;
+
+    // Re-lay the newest records that fit, oldest first from slot 0
+    size_t keep = std::min(m_count, a_capacity);
+    std::vector<SaleRecord> records(a_capacity);
+    for (size_t i = 0; i < keep; ++i) {
+        records[i] = (*this)[keep - 1 - i];
+    }
+    m_records = std::move(records);
+    m_head = keep % a_capacity;
+    m_count = keep;
+}
+
+void TransactionLog::Append(const SaleTransaction& a_transaction) {
+    if (m_records.empty()) SetCapacity(kMinCapacity);
+
+    // Up to three new strings; make room first so IDs stay stable below
+    if (m_strings.size() + 3 > kNoName) CompactStrings();
+
+    SaleRecord record;
+    record.itemFormID = a_transaction.itemFormID;
+    record.vendorID = Intern(a_transaction.vendorName);
+    record.assortmentID = Intern(a_transaction.vendorAssortment);
+    if (IsDynamicForm(a_transaction.itemFormID)) {
+        record.itemNameID = Intern(a_transaction.itemName);
+    }
+    record.quantity = a_transaction.quantity;
+    record.goldEarned = a_transaction.goldEarned;
+    record.pricePerUnit = a_transaction.pricePerUnit;
+    record.gameTime = a_transaction.gameTime;
+    Push(record);
+}
+
+void TransactionLog::Clear() {
+    m_head = 0;
+    m_count = 0;
+    m_strings.clear();
+    m_stringIDs.clear();
+}
+
+const SaleRecord& TransactionLog::operator[](size_t a_index) const {
+    auto capacity = m_records.size();
+    return m_records[(m_head + capacity - 1 - a_index) % capacity];
+}
+
+const std::string& TransactionLog::GetString(uint16_t a_id) const {
+    static const std::string s_empty;
+    return a_id < m_strings.size() ? m_strings[a_id] : s_empty;
+}
+
+std::string TransactionLog::GetItemName(const SaleRecord& a_record) const {
+    if (a_record.itemNameID != kNoName) {
+        return GetString(a_record.itemNameID);
+    }
+    if (auto* form = RE::TESForm::LookupByID(a_record.itemFormID)) {
+        std::string name = form->GetName();
+        if (!name.empty()) return name;
+    }
+    return "Unknown Item";
+}
+
+uint16_t TransactionLog::Intern(const std::string& a_string) {
+    auto it = m_stringIDs.find(a_string);
+    if (it != m_stringIDs.end()) return it->second;
+    if (m_strings.size() >= kNoName) return kNoName;
+
+    auto id = static_cast<uint16_t>(m_strings.size());
+    m_strings.push_back(a_string);
+    m_stringIDs.emplace(a_string, id);
+    return id;
+}
+
+void TransactionLog::Push(const SaleRecord& a_record) {
+    m_records[m_head] = a_record;
+    m_head = (m_head + 1) % m_records.size();
+    if (m_count < m_records.size()) ++m_count;
+}
+
+void TransactionLog::CompactStrings() {
+    std::vector<uint16_t> remap(m_strings.size(), kNoName);
+    std::vector<std::string> live;
+    auto keep = [&](uint16_t& a_id) {
+        if (a_id >= remap.size()) return;
+        if (remap[a_id] == kNoName) {
+            remap[a_id] = static_cast<uint16_t>(live.size());
+            live.push_back(std::move(m_strings[a_id]));
+        }
+        a_id = remap[a_id];
+    };
+
+    for (size_t i = 0; i < m_count; ++i) {
+        auto& record = m_records[(m_head + m_records.size() - 1 - i) % m_records.size()];
+        keep(record.vendorID);
+        keep(record.assortmentID);
+        keep(record.itemNameID);
+    }
+
+    m_strings = std::move(live);
+    m_stringIDs.clear();
+    for (size_t id = 0; id < m_strings.size(); ++id) {
+        m_stringIDs.emplace(m_strings[id], static_cast<uint16_t>(id));
+    }
+    logger::debug("TransactionLog: compacted string table to {} entries", m_strings.size());
+}
+
+void TransactionLog::Save(SKSE::SerializationInterface* a_intfc) const {
+    auto stringCount = static_cast<uint32_t>(m_strings.size());
+    a_intfc->WriteRecordData(&stringCount, sizeof(stringCount));
+    for (const auto& str : m_strings) {
+        WriteString(a_intfc, str);
+    }
+
+    auto txCount = static_cast<uint32_t>(m_count);
+    a_intfc->WriteRecordData(&txCount, sizeof(txCount));
+
+    // Oldest first, so Load can append in order
+    for (size_t i = m_count; i-- > 0;) {
+        const auto& record = (*this)[i];
+        a_intfc->WriteRecordData(&record.itemFormID, sizeof(record.itemFormID));
+        a_intfc->WriteRecordData(&record.vendorID, sizeof(record.vendorID));
+        a_intfc->WriteRecordData(&record.assortmentID, sizeof(record.assortmentID));
+        a_intfc->WriteRecordData(&record.itemNameID, sizeof(record.itemNameID));
+        a_intfc->WriteRecordData(&record.quantity, sizeof(record.quantity));
+        a_intfc->WriteRecordData(&record.goldEarned, sizeof(record.goldEarned));
+        a_intfc->WriteRecordData(&record.pricePerUnit, sizeof(record.pricePerUnit));
+        a_intfc->WriteRecordData(&record.gameTime, sizeof(record.gameTime));
+    }
+}
+
+void TransactionLog::Load(SKSE::SerializationInterface* a_intfc, uint32_t a_version) {
+    Clear();
+    if (m_records.empty()) SetCapacity(kMinCapacity);
+
+    if (a_version < 2) {
+        // v1: newest first, three strings per sale, no FormID
+        uint32_t txCount = 0;
+        a_intfc->ReadRecordData(&txCount, sizeof(txCount));
+        if (txCount > kMaxCapacity) {
+            logger::warn("Transaction log has {} entries (max {}), truncating", txCount, kMaxCapacity);
+            txCount = static_cast<uint32_t>(kMaxCapacity);
+        }
+
+        std::vector<SaleTransaction> transactions(txCount);
+        for (auto& tx : transactions) {
+            tx.itemName = ReadString(a_intfc);
+            tx.vendorName = ReadString(a_intfc);
+            tx.vendorAssortment = ReadString(a_intfc);
+            a_intfc->ReadRecordData(&tx.quantity, sizeof(tx.quantity));
+            a_intfc->ReadRecordData(&tx.goldEarned, sizeof(tx.goldEarned));
+            a_intfc->ReadRecordData(&tx.pricePerUnit, sizeof(tx.pricePerUnit));
+            a_intfc->ReadRecordData(&tx.gameTime, sizeof(tx.gameTime));
+        }
+        for (auto it = transactions.rbegin(); it != transactions.rend(); ++it) {
+            Append(*it);
+        }
+        return;
+    }
+
+    uint32_t stringCount = 0;
+    a_intfc->ReadRecordData(&stringCount, sizeof(stringCount));
+    if (stringCount > kNoName) {
+        logger::error("Transaction log string table has {} entries, skipping log", stringCount);
+        return;
+    }
+    m_strings.reserve(stringCount);
+    for (uint32_t i = 0; i < stringCount; ++i) {
+        m_strings.push_back(ReadString(a_intfc));
+        m_stringIDs.emplace(m_strings.back(), static_cast<uint16_t>(i));
+    }
+
+    uint32_t txCount = 0;
+    a_intfc->ReadRecordData(&txCount, sizeof(txCount));
+
+    // Read every record so the stream stays aligned; the ring keeps the newest
+    for (uint32_t i = 0; i < txCount; ++i) {
+        SaleRecord record;
+        a_intfc->ReadRecordData(&record.itemFormID, sizeof(record.itemFormID));
+        a_intfc->ReadRecordData(&record.vendorID, sizeof(record.vendorID));
+        a_intfc->ReadRecordData(&record.assortmentID, sizeof(record.assortmentID));
+        a_intfc->ReadRecordData(&record.itemNameID, sizeof(record.itemNameID));
+        a_intfc->ReadRecordData(&record.quantity, sizeof(record.quantity));
+        a_intfc->ReadRecordData(&record.goldEarned, sizeof(record.goldEarned));
+        a_intfc->ReadRecordData(&record.pricePerUnit, sizeof(record.pricePerUnit));
+        a_intfc->ReadRecordData(&record.gameTime, sizeof(record.gameTime));
+
+        // Load order may have changed; an unresolvable item shows as unknown
+        if (record.itemNameID == kNoName) {
+            RE::FormID resolved = 0;
+            record.itemFormID = a_intfc->ResolveFormID(record.itemFormID, resolved) ? resolved : 0;
+        }
+        Push(record);
+    }
+}
+
+// --- SalesStats ---
+
+void SalesStats::Add(const std::string& a_vendor, RE::FormType a_type, int32_t a_quantity, int32_t a_gold, float a_gameTime) {
+    auto items = static_cast<uint32_t>(std::max(0, a_quantity));
+    auto gold = static_cast<uint32_t>(std::max(0, a_gold));
+
+    total.items += items;
+    total.gold += gold;
+
+    auto& vendor = byVendor[a_vendor];
+    vendor.items += items;
+    vendor.gold += gold;
+    if (a_vendor != topVendor) {
+        auto top = byVendor.find(topVendor);
+        if (top == byVendor.end() || vendor.gold > top->second.gold) topVendor = a_vendor;
+    }
+
+    auto& type = byFormType[a_type];
+    type.items += items;
+    type.gold += gold;
+
+    uint32_t dayIndex = DayOf(a_gameTime);
+    auto& day = byDay[dayIndex];
+    day.items += items;
+    day.gold += gold;
+    if (dayIndex != bestDay) {
+        auto best = byDay.find(bestDay);
+        if (best == byDay.end() || day.gold > best->second.gold) bestDay = dayIndex;
+    }
+}
+
+void SalesStats::Add(const SaleTransaction& a_transaction) {
+    Add(a_transaction.vendorName, a_transaction.itemType,
+        a_transaction.quantity, a_transaction.goldEarned, a_transaction.gameTime);
+}
+
+void SalesStats::Clear() {
+    *this = SalesStats{};
+}
+
+uint32_t SalesStats::GoldOverDays(uint32_t a_today, uint32_t a_days) const {
+    uint32_t gold = 0;
+    for (uint32_t i = 0; i < a_days && i <= a_today; ++i) {
+        auto it = byDay.find(a_today - i);
+        if (it != byDay.end()) gold += it->second.gold;
+    }
+    return gold;
+}
+
+void SalesStats::Save(SKSE::SerializationInterface* a_intfc) const {
+    auto writeTotals = [&](const SalesTotals& a_totals) {
+        a_intfc->WriteRecordData(&a_totals.items, sizeof(a_totals.items));
+        a_intfc->WriteRecordData(&a_totals.gold, sizeof(a_totals.gold));
+    };
+
+    writeTotals(total);
+    WriteString(a_intfc, topVendor);
+    a_intfc->WriteRecordData(&bestDay, sizeof(bestDay));
+
+    auto vendorCount = static_cast<uint32_t>(byVendor.size());
+    a_intfc->WriteRecordData(&vendorCount, sizeof(vendorCount));
+    for (const auto& [name, totals] : byVendor) {
+        WriteString(a_intfc, name);
+        writeTotals(totals);
+    }
+
+    auto typeCount = static_cast<uint32_t>(byFormType.size());
+    a_intfc->WriteRecordData(&typeCount, sizeof(typeCount));
+    for (const auto& [type, totals] : byFormType) {
+        auto typeByte = static_cast<uint8_t>(type);
+        a_intfc->WriteRecordData(&typeByte, sizeof(typeByte));
+        writeTotals(totals);
+    }
+
+    auto dayCount = static_cast<uint32_t>(byDay.size());
+    a_intfc->WriteRecordData(&dayCount, sizeof(dayCount));
+    for (const auto& [day, totals] : byDay) {
+        a_intfc->WriteRecordData(&day, sizeof(day));
+        writeTotals(totals);
+    }
+}
+
+void SalesStats::Load(SKSE::SerializationInterface* a_intfc) {
+    Clear();
+    auto readTotals = [&](SalesTotals& a_totals) {
+        a_intfc->ReadRecordData(&a_totals.items, sizeof(a_totals.items));
+        a_intfc->ReadRecordData(&a_totals.gold, sizeof(a_totals.gold));
+    };
+
+    readTotals(total);
+    topVendor = ReadString(a_intfc);
+    a_intfc->ReadRecordData(&bestDay, sizeof(bestDay));
+
+    uint32_t vendorCount = 0;
+    a_intfc->ReadRecordData(&vendorCount, sizeof(vendorCount));
+    for (uint32_t i = 0; i < vendorCount; ++i) {
+        auto name = ReadString(a_intfc);
+        readTotals(byVendor[name]);
+    }
+
+    uint32_t typeCount = 0;
+    a_intfc->ReadRecordData(&typeCount, sizeof(typeCount));
+    for (uint32_t i = 0; i < typeCount; ++i) {
+        uint8_t typeByte = 0;
+        a_intfc->ReadRecordData(&typeByte, sizeof(typeByte));
+        readTotals(byFormType[static_cast<RE::FormType>(typeByte)]);
+    }
+
+    uint32_t dayCount = 0;
+    a_intfc->ReadRecordData(&dayCount, sizeof(dayCount));
+    for (uint32_t i = 0; i < dayCount; ++i) {
+        uint32_t day = 0;
+        a_intfc->ReadRecordData(&day, sizeof(day));
+        readTotals(byDay[day]);
+    }
+}
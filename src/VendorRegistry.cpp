@@ -33,6 +33,7 @@ bool VendorRegistry::RegisterVendor(const RegisteredVendor& a_vendor) {
     }
 
     m_vendors.push_back(a_vendor);
+    m_buyListsDirty = true;
     logger::info("VendorRegistry: registered {} ({}) from {} — faction {:08X}",
                  a_vendor.vendorName, a_vendor.npcBaseFormID,
                  a_vendor.storeName, a_vendor.factionFormID);
@@ -101,6 +102,7 @@ void VendorRegistry::SetVendorActive(RE::FormID a_npcBaseFormID, bool a_active)
 void VendorRegistry::ClearAll() {
     std::lock_guard lock(m_lock);
     m_vendors.clear();
+    m_buyListsDirty = true;
     logger::info("VendorRegistry: cleared all vendors");
 }
 
@@ -209,12 +211,14 @@ void VendorRegistry::Load(SKSE::SerializationInterface* a_intfc, uint32_t a_vers
                      m_vendors.back().vendorName, m_vendors.back().npcBaseFormID);
     }
 
+    m_buyListsDirty = true;
     logger::info("VendorRegistry: loaded {} vendors from cosave", m_vendors.size());
 }
 
 void VendorRegistry::Revert() {
     std::lock_guard lock(m_lock);
     m_vendors.clear();
+    m_buyListsDirty = true;
     logger::info("VendorRegistry: reverted");
 }
 
@@ -233,6 +237,7 @@ int VendorRegistry::Validate() {
             logger::warn("VendorRegistry: NPC {:08X} ({}) no longer valid, removing",
                          it->npcBaseFormID, it->vendorName);
             it = m_vendors.erase(it);
+            m_buyListsDirty = true;
             ++pruned;
         } else {
             // Reset stale vendor timer so it starts a fresh cycle with jitter
@@ -254,6 +259,90 @@ int VendorRegistry::Validate() {
     return pruned;
 }
 
+// ---------------------------------------------------------------------------
+// Compiled buy lists
+// ---------------------------------------------------------------------------
+
+std::shared_ptr<const CompiledBuyLists> VendorRegistry::CompileBuyLists() const {
+    auto compiled = std::make_shared<CompiledBuyLists>();
+    auto& keywordBits = compiled->keywordBits;
+    auto& lists = compiled->lists;
+
+    // First pass: assign one bit per distinct keyword
+    std::vector<std::pair<RE::FormID, std::vector<uint16_t>>> listBits;
+    for (const auto& v : m_vendors) {
+        auto factionID = v.factionFormID;
+        if (lists.contains(factionID)) continue;
+        auto* faction = RE::TESForm::LookupByID<RE::TESFaction>(factionID);
+        if (!faction) continue;
+
+        auto& list = lists[factionID];
+        list.inverted = faction->vendorData.vendorValues.notBuySell;
+
+        auto& bits = listBits.emplace_back(factionID, std::vector<uint16_t>{}).second;
+        if (auto* buyList = faction->vendorData.vendorSellBuyList) {
+            buyList->ForEachForm([&](RE::TESForm* a_form) {
+                if (auto* keyword = a_form->As<RE::BGSKeyword>()) {
+                    auto [it, inserted] = keywordBits.try_emplace(
+                        keyword->GetFormID(), static_cast<uint16_t>(keywordBits.size()));
+                    bits.push_back(it->second);
+                }
+                return RE::BSContainer::ForEachResult::kContinue;
+            });
+        }
+    }
+
+    // Second pass: masks sized to the final keyword count
+    size_t words = (keywordBits.size() + 63) / 64;
+    for (const auto& [factionID, bits] : listBits) {
+        auto& mask = lists[factionID].mask;
+        mask.assign(words, 0);
+        for (auto bit : bits) mask[bit / 64] |= uint64_t{1} << (bit % 64);
+    }
+
+    logger::info("VendorRegistry: compiled {} buy lists over {} keywords",
+                 lists.size(), keywordBits.size());
+    return compiled;
+}
+
+std::shared_ptr<const CompiledBuyLists> VendorRegistry::GetBuyLists() {
+    std::lock_guard lock(m_lock);
+    if (m_buyListsDirty || !m_buyLists) {
+        m_buyLists = CompileBuyLists();
+        m_buyListsDirty = false;
+    }
+    return m_buyLists;
+}
+
+const CompiledBuyList* CompiledBuyLists::Find(RE::FormID a_factionFormID) const {
+    auto it = lists.find(a_factionFormID);
+    return it != lists.end() ? &it->second : nullptr;
+}
+
+void CompiledBuyLists::GetItemKeywordMask(RE::TESBoundObject* a_item, std::vector<uint64_t>& a_out) const {
+    a_out.assign((keywordBits.size() + 63) / 64, 0);
+
+    auto* keyworded = a_item ? a_item->As<RE::BGSKeywordForm>() : nullptr;
+    if (!keyworded) return;
+    for (uint32_t i = 0; i < keyworded->numKeywords; ++i) {
+        auto* keyword = keyworded->keywords[i];
+        if (!keyword) continue;
+        auto it = keywordBits.find(keyword->GetFormID());
+        if (it != keywordBits.end()) a_out[it->second / 64] |= uint64_t{1} << (it->second % 64);
+    }
+}
+
+bool VendorRegistry::Buys(const CompiledBuyList& a_buyList, const std::vector<uint64_t>& a_itemMask) {
+    bool matches = false;
+    for (size_t w = 0; w < a_buyList.mask.size() && w < a_itemMask.size(); ++w) {
+        if (a_buyList.mask[w] & a_itemMask[w]) {
+            matches = true;
+            break;
+        }
+    }
+    return a_buyList.inverted ? !matches : matches;
+}
+
 void VendorRegistry::LoadWhitelist() {
     auto dataDirs = Settings::GetDataDirs();
     if (dataDirs.empty()) {
@@ -9,6 +9,7 @@
 #include "WhooshConfigMenu.h"
 #include "RestockConfigMenu.h"
 #include "SalesProcessor.h"
+#include "AutoRouter.h"
 #include "SellOverviewMenu.h"
 #include "SummonChest.h"
 #include "FilterRegistry.h"
@@ -21,9 +22,16 @@
 #include "ContextMenu.h"
 #include "ContainerRegistry.h"
 #include "ContainerRegistryTest.h"
+#include "ContainerScanner.h"
 #include "DisplayName.h"
 #include "Lifecycle.h"
 #include "Diagnostics.h"
+#include "Distributor.h"
+#include "TraitCache.h"
+#include "InventoryCache.h"
+#include "MoveExecutor.h"
+#include "RestockCategory.h"
+#include "RestockIndex.h"
 
 // Container source registration functions (defined in source files)
 void RegisterSpecialContainerSource();
@@ -159,6 +167,8 @@ namespace {
             if (Lifecycle::GetState() == Lifecycle::State::kGameLoading) {
                 Lifecycle::TransitionTo(Lifecycle::State::kWorldReady);
             }
+            // Respawning containers reset without container-change events
+            InventoryCache::Clear();
             return RE::BSEventNotifyControl::kContinue;
         }
 
@@ -175,6 +185,7 @@ namespace {
                 Settings::LoadUniqueItems();
                 TraitEvaluator::Init();
                 FilterRegistry::GetSingleton()->Init();
+                RestockCategory::BuildTable();
                 // Register container sources (order determines priority fallback)
                 RegisterSpecialContainerSource();
                 RegisterNFFContainerSource();
@@ -202,6 +213,9 @@ namespace {
                 RestockConfig::Menu::Register();
                 RestockConfig::InputHandler::Register();
                 SalesProcessor::RegisterEventSinks();
+                InventoryCache::RegisterEventSink();
+                ContainerScanner::RegisterEventSinks();
+                AutoRouter::RegisterEventSink();
                 SummonChest::RegisterEventSink();
                 SellOverview::Menu::Register();
                 SellOverview::InputHandler::Register();
@@ -223,6 +237,15 @@ namespace {
                 logger::info("Game loaded — deferring REFR validation to first cell load");
                 WelcomeMenu::ResetSession();
                 SummonChest::Clear();
+                TraitCache::Clear();
+                RestockCategory::ClearDynamic();
+                RestockIndex::Clear();
+                Distributor::ClearRouteTables();
+                InventoryCache::Clear();
+                ContainerRegistry::GetSingleton()->InvalidateOwnership();
+                ContainerScanner::ClearCache();
+                MoveExecutor::Cancel();
+                AutoRouter::Clear();
                 // Load network/tag/sell config from INI (mod author presets — only adds missing entries)
                 // Safe here: reads INI data + cosave state, doesn't need LookupByID for REFRs
                 NetworkManager::GetSingleton()->LoadConfigFromINI();
@@ -273,6 +296,15 @@ namespace {
                 logger::info("New game started — deferring init to first cell load");
                 WelcomeMenu::ResetSession();
                 SummonChest::Clear();
+                TraitCache::Clear();
+                RestockCategory::ClearDynamic();
+                RestockIndex::Clear();
+                Distributor::ClearRouteTables();
+                InventoryCache::Clear();
+                ContainerRegistry::GetSingleton()->InvalidateOwnership();
+                ContainerScanner::ClearCache();
+                MoveExecutor::Cancel();
+                AutoRouter::Clear();
                 // Defer all player-dependent init to first cell load
                 Lifecycle::DeferUntilWorldReady([]() {
                     NetworkManager::GetSingleton()->LoadConfigFromINI();